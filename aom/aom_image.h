@@ -375,6 +375,35 @@ int aom_img_plane_width(const aom_image_t *img, int plane);
  */
 int aom_img_plane_height(const aom_image_t *img, int plane);
 
+/*!\brief Convert an image to the format and bit depth of another image
+ *
+ * Copies the visible area of src into dst, converting between 8-bit and
+ * high bit depth storage, between bit depths, between the planar and NV12
+ * layouts and between 4:2:0, 4:2:2 and 4:4:4 chroma subsampling. The strides
+ * of the two images may differ. The conversion is controlled by the fmt,
+ * bit_depth and chroma shifts of dst, which must have the same d_w and d_h
+ * as src. Note that aom_img_alloc() sets bit_depth to 16 for high bit depth
+ * formats, so the caller normally sets it to the intended bit depth.
+ *
+ * Raising the bit depth shifts the samples left, and lowering it drops the
+ * low bits. Chroma is averaged when it is downsampled and replicated when it
+ * is upsampled. If src is monochrome, the chroma of dst is set to the
+ * neutral value.
+ *
+ * The supported formats are AOM_IMG_FMT_I420, AOM_IMG_FMT_YV12,
+ * AOM_IMG_FMT_NV12, AOM_IMG_FMT_I422 and AOM_IMG_FMT_I444 with a bit_depth of
+ * 8, and AOM_IMG_FMT_I42016, AOM_IMG_FMT_YV1216, AOM_IMG_FMT_I42216 and
+ * AOM_IMG_FMT_I44416 with a bit_depth from 8 to 16.
+ *
+ * \param[in]    dst          Destination image
+ * \param[in]    src          Source image
+ * \param[in]    num_threads  Number of threads to convert rows on, including
+ *                            the calling thread
+ *
+ * \return 0 on success or -1 if the conversion is not supported.
+ */
+int aom_img_convert(aom_image_t *dst, const aom_image_t *src, int num_threads);
+
 /*!\brief Add metadata to image.
  *
  * Adds metadata to aom_image_t.
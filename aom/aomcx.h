@@ -1575,6 +1575,64 @@ enum aome_enc_control_id {
    */
   AV1E_SET_MAX_CONSEC_FRAME_DROP_MS_CBR = 169,
 
+  /*!\brief Codec control to tune the encoding for fast decoding on a given
+   * number of decoder threads, unsigned int parameter.
+   *
+   * Value of 0 (default) disables decode speed tuning. A nonzero value makes
+   * the encoder choose tile columns and rows for that many decoder threads
+   * (unless AV1E_SET_AUTO_TILES or explicit tile settings are used) and avoid
+   * OBMC and local warped motion in blocks smaller than 16x16, whose decode
+   * cost is high relative to their size.
+   */
+  AV1E_SET_TARGET_DECODER_THREADS = 170,
+
+  /*!\brief Codec control to get the predicted decode time of the last coded
+   * frame, in microseconds, int * parameter.
+   *
+   * The prediction uses the decoder model of the sequence level, with the
+   * level's decode rate shared evenly by the target decoder threads (see
+   * AV1E_SET_TARGET_DECODER_THREADS) and tiles as the unit of parallelism.
+   */
+  AV1E_GET_PREDICTED_DECODE_TIME = 171,
+
+  /*!\brief Codec control to scale input images to the configured frame size
+   * inside the encoder, unsigned int parameter.
+   *
+   * - 0 = disable (default): input images must be g_w x g_h
+   * - 1 = enable: images of any size are resampled to g_w x g_h as they are
+   *   written into the lookahead buffers, so the application needs no
+   *   scaling pass or copy of its own. The image format must still match.
+   *   Denoising (AV1E_SET_DENOISE_NOISE_LEVEL) runs on the scaled frame.
+   */
+  AV1E_SET_SCALE_INPUT = 172,
+
+  /*!\brief Codec control to save the encoder state at a key frame boundary,
+   * aom_fixed_buf_t * parameter.
+   *
+   * Only supported in the second pass of a two-pass encode, without frame
+   * parallel encoding, SVC, forward key frames or S-frames. It succeeds when
+   * the next frame to be coded is a key frame that starts a new key frame
+   * group, i.e. after the packet of the last frame of the previous group has
+   * been returned; otherwise AOM_CODEC_ERROR is returned. On success, buf is
+   * allocated by the encoder and must be freed with free().
+   *
+   * The checkpoint holds no frames. To resume, create an encoder with the same
+   * configuration, controls and first pass statistics, restore the checkpoint
+   * with AV1E_SET_CHECKPOINT, then pass the source frames again starting with
+   * the key frame, i.e. the first frame whose packet had not been returned.
+   * The output is then identical to that of an uninterrupted encode. The
+   * checkpoint is only valid for the same build of the library.
+   */
+  AV1E_GET_CHECKPOINT = 173,
+
+  /*!\brief Codec control to restore the encoder state from a checkpoint,
+   * const aom_fixed_buf_t * parameter.
+   *
+   * Must be called before the first frame is passed to the encoder. See
+   * AV1E_GET_CHECKPOINT.
+   */
+  AV1E_SET_CHECKPOINT = 174,
+
   // Any new encoder control IDs should be added above.
   // Maximum allowed encoder control ID is 229.
   // No encoder control ID should be added below.
@@ -1607,9 +1665,9 @@ typedef enum aom_scaling_mode_1d {
 
 /*!\brief  aom region of interest map
  *
- * These defines the data structures for the region of interest map
- *
- * TODO(yaowu): create a unit test for ROI map related APIs
+ * These defines the data structures for the region of interest map. The map
+ * is coded with segmentation, so it is not applied together with an active
+ * map or an aq-mode that uses segmentation. A NULL roi_map disables it.
  *
  */
 typedef struct aom_roi_map {
@@ -1617,10 +1675,16 @@ typedef struct aom_roi_map {
   unsigned char *roi_map;
   unsigned int rows;              /**< Number of rows. */
   unsigned int cols;              /**< Number of columns. */
-  int delta_q[AOM_MAX_SEGMENTS];  /**< Quantizer deltas. */
-  int delta_lf[AOM_MAX_SEGMENTS]; /**< Loop filter deltas. */
-  /*! Static breakout threshold for each segment. */
+  int delta_q[AOM_MAX_SEGMENTS];  /**< Quantizer index deltas. */
+  /*! Loop filter deltas. Not used by AV1: skip blocks take a predicted
+   * segment id, so a per-segment filter level cannot follow the map. */
+  int delta_lf[AOM_MAX_SEGMENTS];
+  /*! Static breakout threshold for each segment. Not used by AV1. */
   unsigned int static_threshold[AOM_MAX_SEGMENTS];
+  /*! Nonzero to search the segment with low effort: superblocks entirely in
+   * low effort segments use coarse partitions, so encode time follows the
+   * area of the regions searched with full effort. */
+  int low_effort[AOM_MAX_SEGMENTS];
 } aom_roi_map_t;
 
 /*!\brief  aom active region map
@@ -2257,6 +2321,21 @@ AOM_CTRL_USE_TYPE(AV1E_SET_POSTENCODE_DROP_RTC, int)
 AOM_CTRL_USE_TYPE(AV1E_SET_MAX_CONSEC_FRAME_DROP_MS_CBR, int)
 #define AOM_CTRL_AV1E_SET_MAX_CONSEC_FRAME_DROP_MS_CBR
 
+AOM_CTRL_USE_TYPE(AV1E_SET_TARGET_DECODER_THREADS, unsigned int)
+#define AOM_CTRL_AV1E_SET_TARGET_DECODER_THREADS
+
+AOM_CTRL_USE_TYPE(AV1E_GET_PREDICTED_DECODE_TIME, int *)
+#define AOM_CTRL_AV1E_GET_PREDICTED_DECODE_TIME
+
+AOM_CTRL_USE_TYPE(AV1E_SET_SCALE_INPUT, unsigned int)
+#define AOM_CTRL_AV1E_SET_SCALE_INPUT
+
+AOM_CTRL_USE_TYPE(AV1E_GET_CHECKPOINT, aom_fixed_buf_t *)
+#define AOM_CTRL_AV1E_GET_CHECKPOINT
+
+AOM_CTRL_USE_TYPE(AV1E_SET_CHECKPOINT, const aom_fixed_buf_t *)
+#define AOM_CTRL_AV1E_SET_CHECKPOINT
+
 /*!\endcond */
 /*! @} - end defgroup aom_encoder */
 #ifdef __cplusplus
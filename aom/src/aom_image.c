@@ -14,10 +14,14 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "config/aom_dsp_rtcd.h"
+
 #include "aom/aom_image.h"
 #include "aom/aom_integer.h"
 #include "aom/internal/aom_image_internal.h"
+#include "aom_dsp/aom_dsp_common.h"
 #include "aom_mem/aom_mem.h"
+#include "aom_util/aom_thread.h"
 
 static inline unsigned int align_image_dimension(unsigned int d,
                                                  unsigned int subsampling,
@@ -319,6 +323,212 @@ int aom_img_plane_height(const aom_image_t *img, int plane) {
     return img->d_h;
 }
 
+#define IMG_CONVERT_MAX_THREADS 64
+
+typedef struct {
+  aom_image_t *dst;
+  const aom_image_t *src;
+  int band;
+  int num_bands;
+} ImgConvertJob;
+
+static int img_convert_supported(const aom_image_t *img) {
+  switch (img->fmt) {
+    case AOM_IMG_FMT_I420:
+    case AOM_IMG_FMT_YV12:
+    case AOM_IMG_FMT_NV12:
+    case AOM_IMG_FMT_I422:
+    case AOM_IMG_FMT_I444: return img->bit_depth == 8;
+    case AOM_IMG_FMT_I42016:
+    case AOM_IMG_FMT_YV1216:
+    case AOM_IMG_FMT_I42216:
+    case AOM_IMG_FMT_I44416:
+      return img->bit_depth >= 8 && img->bit_depth <= 16;
+    default: return 0;
+  }
+}
+
+// Converts rows [y0, y1) of a plane that has the same layout in both images,
+// so only the sample size and bit depth change.
+static void img_convert_plane_rows(aom_image_t *dst, const aom_image_t *src,
+                                   int plane, int y0, int y1) {
+  const int w = aom_img_plane_width(dst, plane);
+  const int h = y1 - y0;
+  const int shift = (int)dst->bit_depth - (int)src->bit_depth;
+  const int src_stride = src->stride[plane];
+  const int dst_stride = dst->stride[plane];
+  const uint8_t *s = src->planes[plane] + (ptrdiff_t)y0 * src_stride;
+  uint8_t *d = dst->planes[plane] + (ptrdiff_t)y0 * dst_stride;
+
+  if (!(src->fmt & AOM_IMG_FMT_HIGHBITDEPTH)) {
+    if (!(dst->fmt & AOM_IMG_FMT_HIGHBITDEPTH)) {
+      for (int y = 0; y < h; ++y) {
+        memcpy(d, s, w);
+        s += src_stride;
+        d += dst_stride;
+      }
+    } else {
+      aom_upshift_plane_8_to_16(s, src_stride, (uint16_t *)d, dst_stride / 2,
+                                w, h, shift);
+    }
+  } else if (!(dst->fmt & AOM_IMG_FMT_HIGHBITDEPTH)) {
+    aom_downshift_plane_16_to_8((const uint16_t *)s, src_stride / 2, d,
+                                dst_stride, w, h, -shift);
+  } else if (shift >= 0) {
+    aom_upshift_plane_16((const uint16_t *)s, src_stride / 2, (uint16_t *)d,
+                         dst_stride / 2, w, h, shift);
+  } else {
+    aom_downshift_plane_16((const uint16_t *)s, src_stride / 2,
+                           (uint16_t *)d, dst_stride / 2, w, h, -shift);
+  }
+}
+
+// Returns the first sample of a chroma plane and sets the distance in
+// samples between horizontally adjacent samples. The two chroma planes of
+// NV12 are interleaved in planes[AOM_PLANE_U].
+static uint8_t *img_chroma_plane(const aom_image_t *img, int plane,
+                                 int *stride, int *step) {
+  if (img->fmt == AOM_IMG_FMT_NV12) {
+    *stride = img->stride[AOM_PLANE_U];
+    *step = 2;
+    return img->planes[AOM_PLANE_U] + (plane == AOM_PLANE_V);
+  }
+  *stride = img->stride[plane];
+  *step = 1;
+  return img->planes[plane];
+}
+
+static inline int img_read_sample(const uint8_t *row, int hbd, int i) {
+  return hbd ? ((const uint16_t *)row)[i] : row[i];
+}
+
+// Converts rows [y0, y1) of a chroma plane whose subsampling or layout
+// differs between the images. Downsampling averages the covered source
+// samples with rounding and upsampling replicates them.
+static void img_convert_chroma_rows(aom_image_t *dst, const aom_image_t *src,
+                                    int plane, int y0, int y1) {
+  const int w = aom_img_plane_width(dst, plane);
+  const int src_w = aom_img_plane_width(src, plane);
+  const int src_h = aom_img_plane_height(src, plane);
+  const int shift = (int)dst->bit_depth - (int)src->bit_depth;
+  const int src_hbd = (src->fmt & AOM_IMG_FMT_HIGHBITDEPTH) != 0;
+  const int dst_hbd = (dst->fmt & AOM_IMG_FMT_HIGHBITDEPTH) != 0;
+  const int xdown = dst->x_chroma_shift > src->x_chroma_shift;
+  const int xup = dst->x_chroma_shift < src->x_chroma_shift;
+  const int ydown = dst->y_chroma_shift > src->y_chroma_shift;
+  const int yup = dst->y_chroma_shift < src->y_chroma_shift;
+  int src_stride, src_step, dst_stride, dst_step;
+  const uint8_t *const src_buf =
+      img_chroma_plane(src, plane, &src_stride, &src_step);
+  uint8_t *const dst_buf = img_chroma_plane(dst, plane, &dst_stride, &dst_step);
+
+  for (int y = y0; y < y1; ++y) {
+    uint8_t *const d = dst_buf + (ptrdiff_t)y * dst_stride;
+    if (src->monochrome) {
+      const int neutral = 1 << (dst->bit_depth - 1);
+      for (int x = 0; x < w; ++x) {
+        if (dst_hbd)
+          ((uint16_t *)d)[x * dst_step] = (uint16_t)neutral;
+        else
+          d[x * dst_step] = (uint8_t)neutral;
+      }
+      continue;
+    }
+    const int sy0 = ydown ? 2 * y : (yup ? y >> 1 : y);
+    const int sy1 = ydown ? AOMMIN(2 * y + 1, src_h - 1) : sy0;
+    const uint8_t *const r0 = src_buf + (ptrdiff_t)sy0 * src_stride;
+    const uint8_t *const r1 = src_buf + (ptrdiff_t)sy1 * src_stride;
+    for (int x = 0; x < w; ++x) {
+      const int sx0 = xdown ? 2 * x : (xup ? x >> 1 : x);
+      const int sx1 = xdown ? AOMMIN(2 * x + 1, src_w - 1) : sx0;
+      // Always sums four samples so that 1, 2 and 4 distinct samples all
+      // average with the same rounding.
+      const int sum = img_read_sample(r0, src_hbd, sx0 * src_step) +
+                      img_read_sample(r0, src_hbd, sx1 * src_step) +
+                      img_read_sample(r1, src_hbd, sx0 * src_step) +
+                      img_read_sample(r1, src_hbd, sx1 * src_step);
+      const int v = shift >= 0 ? ((sum + 2) >> 2) << shift
+                               : ((sum + 2) >> 2) >> -shift;
+      if (dst_hbd)
+        ((uint16_t *)d)[x * dst_step] = (uint16_t)v;
+      else
+        d[x * dst_step] = (uint8_t)v;
+    }
+  }
+}
+
+static int img_convert_worker_hook(void *arg1, void *unused) {
+  const ImgConvertJob *const job = (const ImgConvertJob *)arg1;
+  aom_image_t *const dst = job->dst;
+  const aom_image_t *const src = job->src;
+  const int direct_chroma = !src->monochrome &&
+                            src->fmt != AOM_IMG_FMT_NV12 &&
+                            dst->fmt != AOM_IMG_FMT_NV12 &&
+                            src->x_chroma_shift == dst->x_chroma_shift &&
+                            src->y_chroma_shift == dst->y_chroma_shift;
+  (void)unused;
+
+  for (int plane = 0; plane < 3; ++plane) {
+    const int h = aom_img_plane_height(dst, plane);
+    const int y0 = h * job->band / job->num_bands;
+    const int y1 = h * (job->band + 1) / job->num_bands;
+    if (y0 == y1) continue;
+    if (plane == AOM_PLANE_Y || direct_chroma)
+      img_convert_plane_rows(dst, src, plane, y0, y1);
+    else
+      img_convert_chroma_rows(dst, src, plane, y0, y1);
+  }
+  return 1;
+}
+
+int aom_img_convert(aom_image_t *dst, const aom_image_t *src,
+                    int num_threads) {
+  if (!dst || !src || dst->d_w != src->d_w || dst->d_h != src->d_h ||
+      !img_convert_supported(dst) || !img_convert_supported(src)) {
+    return -1;
+  }
+  aom_dsp_rtcd();
+
+  num_threads = clamp(num_threads, 1, IMG_CONVERT_MAX_THREADS);
+  num_threads = AOMMIN(num_threads, (int)dst->d_h);
+
+  const AVxWorkerInterface *const winterface = aom_get_worker_interface();
+  AVxWorker workers[IMG_CONVERT_MAX_THREADS];
+  ImgConvertJob jobs[IMG_CONVERT_MAX_THREADS];
+  int num_workers = 0;
+  // The calling thread converts the last band, so it needs one fewer worker
+  // than bands.
+  for (int i = 0; i < num_threads - 1; ++i) {
+    AVxWorker *const worker = &workers[num_workers];
+    winterface->init(worker);
+    worker->thread_name = "aom img convert";
+    if (!winterface->reset(worker)) break;
+    ++num_workers;
+  }
+
+  const int num_bands = num_workers + 1;
+  for (int i = 0; i < num_bands; ++i) {
+    jobs[i].dst = dst;
+    jobs[i].src = src;
+    jobs[i].band = i;
+    jobs[i].num_bands = num_bands;
+  }
+  for (int i = 0; i < num_workers; ++i) {
+    workers[i].hook = img_convert_worker_hook;
+    workers[i].data1 = &jobs[i];
+    workers[i].data2 = NULL;
+    winterface->launch(&workers[i]);
+  }
+  img_convert_worker_hook(&jobs[num_workers], NULL);
+
+  int ret = 0;
+  for (int i = 0; i < num_workers; ++i) {
+    if (!winterface->sync(&workers[i])) ret = -1;
+    winterface->end(&workers[i]);
+  }
+  return ret;
+}
+
 aom_metadata_t *aom_img_metadata_alloc(
     uint32_t type, const uint8_t *data, size_t sz,
     aom_metadata_insert_flags_t insert_flag) {
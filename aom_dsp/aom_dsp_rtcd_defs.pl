@@ -544,6 +544,19 @@ if (aom_config("CONFIG_AV1_HIGHBITDEPTH") eq "yes") {
   specialize qw/aom_highbd_convolve8_vert sse2 avx2 neon sve/;
 }
 
+#
+# Image bit depth conversion
+#
+add_proto qw/void aom_upshift_plane_8_to_16/, "const uint8_t *src, ptrdiff_t src_stride, uint16_t *dst, ptrdiff_t dst_stride, int w, int h, int shift";
+add_proto qw/void aom_downshift_plane_16_to_8/, "const uint16_t *src, ptrdiff_t src_stride, uint8_t *dst, ptrdiff_t dst_stride, int w, int h, int shift";
+add_proto qw/void aom_upshift_plane_16/, "const uint16_t *src, ptrdiff_t src_stride, uint16_t *dst, ptrdiff_t dst_stride, int w, int h, int shift";
+add_proto qw/void aom_downshift_plane_16/, "const uint16_t *src, ptrdiff_t src_stride, uint16_t *dst, ptrdiff_t dst_stride, int w, int h, int shift";
+
+specialize qw/aom_upshift_plane_8_to_16   sse2 avx2/;
+specialize qw/aom_downshift_plane_16_to_8 sse2 avx2/;
+specialize qw/aom_upshift_plane_16        sse2 avx2/;
+specialize qw/aom_downshift_plane_16      sse2 avx2/;
+
 #
 # Loopfilter
 #
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2024, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include "config/aom_dsp_rtcd.h"
+
+// Bit depth conversions of a plane of samples, used by aom_img_convert().
+// Down shifts drop the low bits, and the results are truncated to the width
+// of the destination samples.
+
+void aom_upshift_plane_8_to_16_c(const uint8_t *src, ptrdiff_t src_stride,
+                                 uint16_t *dst, ptrdiff_t dst_stride, int w,
+                                 int h, int shift) {
+  for (int y = 0; y < h; ++y) {
+    for (int x = 0; x < w; ++x) dst[x] = (uint16_t)(src[x] << shift);
+    src += src_stride;
+    dst += dst_stride;
+  }
+}
+
+void aom_downshift_plane_16_to_8_c(const uint16_t *src, ptrdiff_t src_stride,
+                                   uint8_t *dst, ptrdiff_t dst_stride, int w,
+                                   int h, int shift) {
+  for (int y = 0; y < h; ++y) {
+    for (int x = 0; x < w; ++x) dst[x] = (uint8_t)(src[x] >> shift);
+    src += src_stride;
+    dst += dst_stride;
+  }
+}
+
+void aom_upshift_plane_16_c(const uint16_t *src, ptrdiff_t src_stride,
+                            uint16_t *dst, ptrdiff_t dst_stride, int w, int h,
+                            int shift) {
+  for (int y = 0; y < h; ++y) {
+    for (int x = 0; x < w; ++x) dst[x] = (uint16_t)(src[x] << shift);
+    src += src_stride;
+    dst += dst_stride;
+  }
+}
+
+void aom_downshift_plane_16_c(const uint16_t *src, ptrdiff_t src_stride,
+                              uint16_t *dst, ptrdiff_t dst_stride, int w,
+                              int h, int shift) {
+  for (int y = 0; y < h; ++y) {
+    for (int x = 0; x < w; ++x) dst[x] = src[x] >> shift;
+    src += src_stride;
+    dst += dst_stride;
+  }
+}
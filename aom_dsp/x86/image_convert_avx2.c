@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2024, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include <immintrin.h>
+
+#include "config/aom_dsp_rtcd.h"
+
+void aom_upshift_plane_8_to_16_avx2(const uint8_t *src, ptrdiff_t src_stride,
+                                    uint16_t *dst, ptrdiff_t dst_stride, int w,
+                                    int h, int shift) {
+  const __m128i count = _mm_cvtsi32_si128(shift);
+  for (int y = 0; y < h; ++y) {
+    int x = 0;
+    for (; x + 32 <= w; x += 32) {
+      const __m256i lo = _mm256_cvtepu8_epi16(
+          _mm_loadu_si128((const __m128i *)(src + x)));
+      const __m256i hi = _mm256_cvtepu8_epi16(
+          _mm_loadu_si128((const __m128i *)(src + x + 16)));
+      _mm256_storeu_si256((__m256i *)(dst + x), _mm256_sll_epi16(lo, count));
+      _mm256_storeu_si256((__m256i *)(dst + x + 16),
+                          _mm256_sll_epi16(hi, count));
+    }
+    for (; x < w; ++x) dst[x] = (uint16_t)(src[x] << shift);
+    src += src_stride;
+    dst += dst_stride;
+  }
+}
+
+void aom_downshift_plane_16_to_8_avx2(const uint16_t *src,
+                                      ptrdiff_t src_stride, uint8_t *dst,
+                                      ptrdiff_t dst_stride, int w, int h,
+                                      int shift) {
+  const __m128i count = _mm_cvtsi32_si128(shift);
+  // Masking before the saturating pack makes it truncate, as the C code does.
+  const __m256i mask = _mm256_set1_epi16(0xff);
+  for (int y = 0; y < h; ++y) {
+    int x = 0;
+    for (; x + 32 <= w; x += 32) {
+      const __m256i s0 = _mm256_loadu_si256((const __m256i *)(src + x));
+      const __m256i s1 = _mm256_loadu_si256((const __m256i *)(src + x + 16));
+      const __m256i d0 = _mm256_and_si256(_mm256_srl_epi16(s0, count), mask);
+      const __m256i d1 = _mm256_and_si256(_mm256_srl_epi16(s1, count), mask);
+      // The pack works within 128-bit lanes, so restore the sample order.
+      const __m256i d = _mm256_permute4x64_epi64(_mm256_packus_epi16(d0, d1),
+                                                 0xd8);
+      _mm256_storeu_si256((__m256i *)(dst + x), d);
+    }
+    for (; x < w; ++x) dst[x] = (uint8_t)(src[x] >> shift);
+    src += src_stride;
+    dst += dst_stride;
+  }
+}
+
+void aom_upshift_plane_16_avx2(const uint16_t *src, ptrdiff_t src_stride,
+                               uint16_t *dst, ptrdiff_t dst_stride, int w,
+                               int h, int shift) {
+  const __m128i count = _mm_cvtsi32_si128(shift);
+  for (int y = 0; y < h; ++y) {
+    int x = 0;
+    for (; x + 16 <= w; x += 16) {
+      const __m256i s = _mm256_loadu_si256((const __m256i *)(src + x));
+      _mm256_storeu_si256((__m256i *)(dst + x), _mm256_sll_epi16(s, count));
+    }
+    for (; x < w; ++x) dst[x] = (uint16_t)(src[x] << shift);
+    src += src_stride;
+    dst += dst_stride;
+  }
+}
+
+void aom_downshift_plane_16_avx2(const uint16_t *src, ptrdiff_t src_stride,
+                                 uint16_t *dst, ptrdiff_t dst_stride, int w,
+                                 int h, int shift) {
+  const __m128i count = _mm_cvtsi32_si128(shift);
+  for (int y = 0; y < h; ++y) {
+    int x = 0;
+    for (; x + 16 <= w; x += 16) {
+      const __m256i s = _mm256_loadu_si256((const __m256i *)(src + x));
+      _mm256_storeu_si256((__m256i *)(dst + x), _mm256_srl_epi16(s, count));
+    }
+    for (; x < w; ++x) dst[x] = src[x] >> shift;
+    src += src_stride;
+    dst += dst_stride;
+  }
+}
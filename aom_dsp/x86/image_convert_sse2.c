@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2024, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include <emmintrin.h>
+
+#include "config/aom_dsp_rtcd.h"
+
+void aom_upshift_plane_8_to_16_sse2(const uint8_t *src, ptrdiff_t src_stride,
+                                    uint16_t *dst, ptrdiff_t dst_stride, int w,
+                                    int h, int shift) {
+  const __m128i count = _mm_cvtsi32_si128(shift);
+  const __m128i zero = _mm_setzero_si128();
+  for (int y = 0; y < h; ++y) {
+    int x = 0;
+    for (; x + 16 <= w; x += 16) {
+      const __m128i s = _mm_loadu_si128((const __m128i *)(src + x));
+      const __m128i lo = _mm_sll_epi16(_mm_unpacklo_epi8(s, zero), count);
+      const __m128i hi = _mm_sll_epi16(_mm_unpackhi_epi8(s, zero), count);
+      _mm_storeu_si128((__m128i *)(dst + x), lo);
+      _mm_storeu_si128((__m128i *)(dst + x + 8), hi);
+    }
+    for (; x < w; ++x) dst[x] = (uint16_t)(src[x] << shift);
+    src += src_stride;
+    dst += dst_stride;
+  }
+}
+
+void aom_downshift_plane_16_to_8_sse2(const uint16_t *src,
+                                      ptrdiff_t src_stride, uint8_t *dst,
+                                      ptrdiff_t dst_stride, int w, int h,
+                                      int shift) {
+  const __m128i count = _mm_cvtsi32_si128(shift);
+  // Masking before the saturating pack makes it truncate, as the C code does.
+  const __m128i mask = _mm_set1_epi16(0xff);
+  for (int y = 0; y < h; ++y) {
+    int x = 0;
+    for (; x + 16 <= w; x += 16) {
+      const __m128i s0 = _mm_loadu_si128((const __m128i *)(src + x));
+      const __m128i s1 = _mm_loadu_si128((const __m128i *)(src + x + 8));
+      const __m128i d0 = _mm_and_si128(_mm_srl_epi16(s0, count), mask);
+      const __m128i d1 = _mm_and_si128(_mm_srl_epi16(s1, count), mask);
+      _mm_storeu_si128((__m128i *)(dst + x), _mm_packus_epi16(d0, d1));
+    }
+    for (; x < w; ++x) dst[x] = (uint8_t)(src[x] >> shift);
+    src += src_stride;
+    dst += dst_stride;
+  }
+}
+
+void aom_upshift_plane_16_sse2(const uint16_t *src, ptrdiff_t src_stride,
+                               uint16_t *dst, ptrdiff_t dst_stride, int w,
+                               int h, int shift) {
+  const __m128i count = _mm_cvtsi32_si128(shift);
+  for (int y = 0; y < h; ++y) {
+    int x = 0;
+    for (; x + 8 <= w; x += 8) {
+      const __m128i s = _mm_loadu_si128((const __m128i *)(src + x));
+      _mm_storeu_si128((__m128i *)(dst + x), _mm_sll_epi16(s, count));
+    }
+    for (; x < w; ++x) dst[x] = (uint16_t)(src[x] << shift);
+    src += src_stride;
+    dst += dst_stride;
+  }
+}
+
+void aom_downshift_plane_16_sse2(const uint16_t *src, ptrdiff_t src_stride,
+                                 uint16_t *dst, ptrdiff_t dst_stride, int w,
+                                 int h, int shift) {
+  const __m128i count = _mm_cvtsi32_si128(shift);
+  for (int y = 0; y < h; ++y) {
+    int x = 0;
+    for (; x + 8 <= w; x += 8) {
+      const __m128i s = _mm_loadu_si128((const __m128i *)(src + x));
+      _mm_storeu_si128((__m128i *)(dst + x), _mm_srl_epi16(s, count));
+    }
+    for (; x < w; ++x) dst[x] = src[x] >> shift;
+    src += src_stride;
+    dst += dst_stride;
+  }
+}
@@ -55,6 +55,26 @@ int aom_free_frame_buffer(YV12_BUFFER_CONFIG *ybf) {
   return AOM_CODEC_MEM_ERROR;
 }
 
+// Zeros the border of a plane and the padding right of and below its crop
+// area. Nothing writes these before the first border extension, but motion
+// search and the SIMD filters may read them.
+static void zero_plane_border(uint8_t *buf, int stride, int crop_width,
+                              int crop_height, int height, int border_w,
+                              int border_h, int bytes_per_pixel) {
+  const size_t row_bytes = (size_t)stride * bytes_per_pixel;
+  const size_t left_bytes = (size_t)border_w * bytes_per_pixel;
+  const size_t right_bytes =
+      (size_t)(stride - border_w - crop_width) * bytes_per_pixel;
+  uint8_t *row = buf - border_h * row_bytes - left_bytes;
+  memset(row, 0, border_h * row_bytes);
+  row += border_h * row_bytes;
+  for (int r = 0; r < crop_height; ++r, row += row_bytes) {
+    memset(row, 0, left_bytes);
+    memset(row + row_bytes - right_bytes, 0, right_bytes);
+  }
+  memset(row, 0, (size_t)(height - crop_height + border_h) * row_bytes);
+}
+
 static int realloc_frame_buffer_aligned(
     YV12_BUFFER_CONFIG *ybf, int width, int height, int ss_x, int ss_y,
     int use_highbitdepth, int border, int byte_alignment,
@@ -70,6 +90,7 @@ static int realloc_frame_buffer_aligned(
         (1 + use_highbitdepth) * (yplane_size + 2 * uvplane_size);
 
     uint8_t *buf = NULL;
+    int zero_border = 0;
 
 #if CONFIG_REALTIME_ONLY || !CONFIG_AV1_ENCODER
     // We should only need an 8-bit version of the source frame if we are
@@ -113,13 +134,10 @@ static int realloc_frame_buffer_aligned(
 
       ybf->buffer_alloc = (uint8_t *)aom_align_addr(fb->data, 32);
 
-#if defined(__has_feature)
-#if __has_feature(memory_sanitizer)
-      // This memset is needed for fixing the issue of using uninitialized
-      // value in msan test. It will cause a perf loss, so only do this for
-      // msan test.
+      // Pixels outside the frame never reach the decoder output: reference
+      // blocks that cross the frame edge are padded in extend_mc_border().
+#if AOM_ZERO_FILL_FRAME_BUFFERS
       memset(ybf->buffer_alloc, 0, (size_t)frame_size);
-#endif
 #endif
     } else if (frame_size > ybf->buffer_alloc_sz) {
       // Allocation to hold larger frame, or first allocation.
@@ -134,10 +152,11 @@ static int realloc_frame_buffer_aligned(
 
       ybf->buffer_alloc_sz = (size_t)frame_size;
 
-      // This memset is needed for fixing valgrind error from C loop filter
-      // due to access uninitialized memory in frame border. It could be
-      // removed if border is totally removed.
+#if AOM_ZERO_FILL_FRAME_BUFFERS
       memset(ybf->buffer_alloc, 0, ybf->buffer_alloc_sz);
+#else
+      zero_border = 1;
+#endif
     }
 
     ybf->y_crop_width = width;
@@ -181,6 +200,25 @@ static int realloc_frame_buffer_aligned(
       ybf->v_buffer = NULL;
     }
 
+    if (zero_border) {
+      // Plane pointers count pixels, which are 2 bytes in high bitdepth.
+      const int bytes_per_pixel = 1 + use_highbitdepth;
+      uint8_t *const alloc = ybf->buffer_alloc;
+      zero_plane_border(alloc + (ybf->y_buffer - buf) * bytes_per_pixel,
+                        y_stride, width, height, aligned_height, border,
+                        border, bytes_per_pixel);
+      if (!alloc_y_plane_only) {
+        zero_plane_border(alloc + (ybf->u_buffer - buf) * bytes_per_pixel,
+                          uv_stride, ybf->uv_crop_width, ybf->uv_crop_height,
+                          uv_height, uv_border_w, uv_border_h,
+                          bytes_per_pixel);
+        zero_plane_border(alloc + (ybf->v_buffer - buf) * bytes_per_pixel,
+                          uv_stride, ybf->uv_crop_width, ybf->uv_crop_height,
+                          uv_height, uv_border_w, uv_border_h,
+                          bytes_per_pixel);
+      }
+    }
+
     ybf->use_external_reference_buffers = 0;
 
 #if CONFIG_AV1_ENCODER && !CONFIG_REALTIME_ONLY
@@ -34,6 +34,20 @@ extern "C" {
 #define AOM_ENC_ALLINTRA_BORDER 64
 #define AOM_DEC_BORDER_IN_PIXELS 64
 
+// Frame buffers are handed out uninitialized, except for the borders of
+// buffers the library allocates itself. Builds that check for reads of
+// uninitialized memory zero-fill them instead.
+#if CONFIG_ZERO_FRAME_BUFFERS
+#define AOM_ZERO_FILL_FRAME_BUFFERS 1
+#elif defined(__has_feature)
+#if __has_feature(memory_sanitizer)
+#define AOM_ZERO_FILL_FRAME_BUFFERS 1
+#endif
+#endif
+#ifndef AOM_ZERO_FILL_FRAME_BUFFERS
+#define AOM_ZERO_FILL_FRAME_BUFFERS 0
+#endif
+
 #if CONFIG_AV1_ENCODER && !CONFIG_REALTIME_ONLY
 struct image_pyramid;
 struct corner_list;
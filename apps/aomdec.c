@@ -34,6 +34,7 @@
 #include "common/md5_utils.h"
 #include "common/obudec.h"
 #include "common/tools_common.h"
+#include "common/xxhash_utils.h"
 
 #if CONFIG_WEBM_IO
 #include "common/webmdec.h"
@@ -93,6 +94,8 @@ static const arg_def_t fb_arg =
     ARG_DEF(NULL, "frame-buffers", 1, "Number of frame buffers to use");
 static const arg_def_t md5arg =
     ARG_DEF(NULL, "md5", 0, "Compute the MD5 sum of the decoded frame");
+static const arg_def_t xxhasharg = ARG_DEF(
+    NULL, "xxhash", 0, "Compute the XXH64 hash of the decoded frame (faster)");
 static const arg_def_t framestatsarg =
     ARG_DEF(NULL, "framestats", 1, "Output per-frame stats (.csv format)");
 static const arg_def_t outbitdeptharg =
@@ -107,13 +110,13 @@ static const arg_def_t skipfilmgrain =
     ARG_DEF(NULL, "skip-film-grain", 0, "Skip film grain application");
 
 static const arg_def_t *all_args[] = {
-  &help,           &codecarg, &use_yv12,      &use_i420,
-  &flipuvarg,      &rawvideo, &noblitarg,     &progressarg,
-  &limitarg,       &skiparg,  &summaryarg,    &outputfile,
-  &threadsarg,     &rowmtarg, &verbosearg,    &scalearg,
-  &fb_arg,         &md5arg,   &framestatsarg, &continuearg,
-  &outbitdeptharg, &isannexb, &oppointarg,    &outallarg,
-  &skipfilmgrain,  NULL
+  &help,        &codecarg,       &use_yv12,   &use_i420,
+  &flipuvarg,   &rawvideo,       &noblitarg,  &progressarg,
+  &limitarg,    &skiparg,        &summaryarg, &outputfile,
+  &threadsarg,  &rowmtarg,       &verbosearg, &scalearg,
+  &fb_arg,      &md5arg,         &xxhasharg,  &framestatsarg,
+  &continuearg, &outbitdeptharg, &isannexb,   &oppointarg,
+  &outallarg,   &skipfilmgrain,  NULL
 };
 
 #if CONFIG_LIBYUV
@@ -422,10 +425,52 @@ static int is_single_file(const char *outfile_pattern) {
   return 1;
 }
 
-static void print_md5(unsigned char digest[16], const char *filename) {
-  int i;
+// Hash of the decoded output, computed instead of writing the output with
+// --md5 or --xxhash.
+typedef struct OutputHash {
+  int use_xxhash;
+  MD5Context md5;
+  XXH64Context xxh64;
+} OutputHash;
+
+static void output_hash_init(OutputHash *hash) {
+  if (hash->use_xxhash)
+    XXH64Init(&hash->xxh64);
+  else
+    MD5Init(&hash->md5);
+}
 
-  for (i = 0; i < 16; ++i) printf("%02x", digest[i]);
+static void output_hash_update(OutputHash *hash, const char *buf, size_t len) {
+  if (hash->use_xxhash)
+    XXH64Update(&hash->xxh64, (const unsigned char *)buf, len);
+  else
+    MD5Update(&hash->md5, (md5byte *)buf, (unsigned int)len);
+}
+
+static void output_hash_update_image(OutputHash *hash, const aom_image_t *img,
+                                     const int *planes, int num_planes,
+                                     int use_y4m) {
+  if (hash->use_xxhash) {
+    if (use_y4m)
+      y4m_update_image_xxhash(img, planes, &hash->xxh64);
+    else
+      raw_update_image_xxhash(img, planes, num_planes, &hash->xxh64);
+  } else {
+    if (use_y4m)
+      y4m_update_image_md5(img, planes, &hash->md5);
+    else
+      raw_update_image_md5(img, planes, num_planes, &hash->md5);
+  }
+}
+
+static void output_hash_print(OutputHash *hash, const char *filename) {
+  if (hash->use_xxhash) {
+    printf("%016" PRIx64, XXH64Final(&hash->xxh64));
+  } else {
+    unsigned char digest[16];
+    MD5Final(digest, &hash->md5);
+    for (int i = 0; i < 16; ++i) printf("%02x", digest[i]);
+  }
   printf("  %s\n", filename);
 }
 
@@ -449,7 +494,7 @@ static int main_loop(int argc, const char **argv_) {
   size_t bytes_in_buffer = 0, buffer_size = 0;
   FILE *infile;
   int frame_in = 0, frame_out = 0, flipuv = 0, noblit = 0;
-  int do_md5 = 0, progress = 0;
+  int do_hash = 0, progress = 0;
   int stop_after = 0, summary = 0, quiet = 1;
   int arg_skip = 0;
   int keep_going = 0;
@@ -484,8 +529,8 @@ static int main_loop(int argc, const char **argv_) {
 
   FILE *framestats_file = NULL;
 
-  MD5Context md5_ctx;
-  unsigned char md5_digest[16];
+  OutputHash output_hash;
+  output_hash.use_xxhash = 0;
 
   struct AvxDecInputContext input = { NULL, NULL, NULL };
   struct AvxInputContext aom_input_ctx;
@@ -554,7 +599,10 @@ static int main_loop(int argc, const char **argv_) {
     } else if (arg_match(&arg, &skiparg, argi)) {
       arg_skip = arg_parse_uint(&arg);
     } else if (arg_match(&arg, &md5arg, argi)) {
-      do_md5 = 1;
+      do_hash = 1;
+    } else if (arg_match(&arg, &xxhasharg, argi)) {
+      do_hash = 1;
+      output_hash.use_xxhash = 1;
     } else if (arg_match(&arg, &framestatsarg, argi)) {
       framestats_file = fopen(arg.val, "w");
       if (!framestats_file) {
@@ -621,7 +669,7 @@ static int main_loop(int argc, const char **argv_) {
   }
 #if CONFIG_OS_SUPPORT
   /* Make sure we don't dump to the terminal, unless forced to with -o - */
-  if (!outfile_pattern && isatty(STDOUT_FILENO) && !do_md5 && !noblit) {
+  if (!outfile_pattern && isatty(STDOUT_FILENO) && !do_hash && !noblit) {
     fprintf(stderr,
             "Not dumping raw video to your terminal. Use '-o -' to "
             "override.\n");
@@ -667,8 +715,8 @@ static int main_loop(int argc, const char **argv_) {
   if (!noblit && single_file) {
     generate_filename(outfile_pattern, outfile_name, PATH_MAX,
                       aom_input_ctx.width, aom_input_ctx.height, 0);
-    if (do_md5)
-      MD5Init(&md5_ctx);
+    if (do_hash)
+      output_hash_init(&output_hash);
     else
       outfile = open_outfile(outfile_name);
   }
@@ -938,8 +986,8 @@ static int main_loop(int argc, const char **argv_) {
                         "Warning: Y4M lacks a colorspace for colocated "
                         "chroma. Using a placeholder.\n");
               }
-              if (do_md5) {
-                MD5Update(&md5_ctx, (md5byte *)y4m_buf, (unsigned int)len);
+              if (do_hash) {
+                output_hash_update(&output_hash, y4m_buf, len);
               } else {
                 fputs(y4m_buf, outfile);
               }
@@ -947,9 +995,10 @@ static int main_loop(int argc, const char **argv_) {
 
             // Y4M frame header
             len = y4m_write_frame_header(y4m_buf, sizeof(y4m_buf));
-            if (do_md5) {
-              MD5Update(&md5_ctx, (md5byte *)y4m_buf, (unsigned int)len);
-              y4m_update_image_md5(img, planes, &md5_ctx);
+            if (do_hash) {
+              output_hash_update(&output_hash, y4m_buf, len);
+              output_hash_update_image(&output_hash, img, planes, num_planes,
+                                       1);
             } else {
               fputs(y4m_buf, outfile);
               y4m_write_image_file(img, planes, outfile);
@@ -976,8 +1025,9 @@ static int main_loop(int argc, const char **argv_) {
                 }
               }
             }
-            if (do_md5) {
-              raw_update_image_md5(img, planes, num_planes, &md5_ctx);
+            if (do_hash) {
+              output_hash_update_image(&output_hash, img, planes, num_planes,
+                                       0);
             } else {
               raw_write_image_file(img, planes, num_planes, outfile);
             }
@@ -985,15 +1035,11 @@ static int main_loop(int argc, const char **argv_) {
         } else {
           generate_filename(outfile_pattern, outfile_name, PATH_MAX, img->d_w,
                             img->d_h, frame_in);
-          if (do_md5) {
-            MD5Init(&md5_ctx);
-            if (use_y4m) {
-              y4m_update_image_md5(img, planes, &md5_ctx);
-            } else {
-              raw_update_image_md5(img, planes, num_planes, &md5_ctx);
-            }
-            MD5Final(md5_digest, &md5_ctx);
-            print_md5(md5_digest, outfile_name);
+          if (do_hash) {
+            output_hash_init(&output_hash);
+            output_hash_update_image(&output_hash, img, planes, num_planes,
+                                     use_y4m);
+            output_hash_print(&output_hash, outfile_name);
           } else {
             outfile = open_outfile(outfile_name);
             if (use_y4m) {
@@ -1029,9 +1075,8 @@ fail:
 fail2:
 
   if (!noblit && single_file) {
-    if (do_md5) {
-      MD5Final(md5_digest, &md5_ctx);
-      print_md5(md5_digest, outfile_name);
+    if (do_hash) {
+      output_hash_print(&output_hash, outfile_name);
     } else {
       fclose(outfile);
     }
@@ -242,6 +242,7 @@ static const int av1_arg_ctrl_map[] = { AOME_SET_CPUUSED,
                                         AV1E_SET_AUTO_INTRA_TOOLS_OFF,
                                         AV1E_ENABLE_RATE_GUIDE_DELTAQ,
                                         AV1E_SET_RATE_DISTRIBUTION_INFO,
+                                        AV1E_SET_SCALE_INPUT,
                                         0 };
 
 static const arg_def_t *const main_args[] = {
@@ -454,6 +455,7 @@ static const arg_def_t *const av1_ctrl_args[] = {
   &g_av1_codec_arg_defs.auto_intra_tools_off,
   &g_av1_codec_arg_defs.enable_rate_guide_deltaq,
   &g_av1_codec_arg_defs.rate_distribution_info,
+  &g_av1_codec_arg_defs.scale_input,
   NULL,
 };
 
@@ -467,6 +469,7 @@ static const arg_def_t *const av1_key_val_args[] = {
   &g_av1_codec_arg_defs.dist_metric,
   &g_av1_codec_arg_defs.kf_max_pyr_height,
   &g_av1_codec_arg_defs.auto_tiles,
+  &g_av1_codec_arg_defs.target_decoder_threads,
   NULL,
 };
 
@@ -549,6 +552,8 @@ struct stream_config {
   const char *partition_info_path;
   unsigned int enable_rate_guide_deltaq;
   const char *rate_distribution_info;
+  // whether the encoder scales input of a different size
+  unsigned int scale_input;
   aom_color_range_t color_range;
   const char *two_pass_input;
   const char *two_pass_output;
@@ -1152,6 +1157,8 @@ static int parse_stream_params(struct AvxEncoderConfig *global,
     } else if (arg_match(&arg, &g_av1_codec_arg_defs.rate_distribution_info,
                          argi)) {
       config->rate_distribution_info = arg.val;
+    } else if (arg_match(&arg, &g_av1_codec_arg_defs.scale_input, argi)) {
+      config->scale_input = arg_parse_uint(&arg);
     } else if (arg_match(&arg, &g_av1_codec_arg_defs.use_fixed_qp_offsets,
                          argi)) {
       config->cfg.use_fixed_qp_offsets = arg_parse_uint(&arg);
@@ -1561,6 +1568,11 @@ static void initialize_encoder(struct stream_state *stream,
                                   stream->config.rate_distribution_info);
     ctx_exit_on_error(&stream->encoder, "Failed to set rate distribution info");
   }
+  if (stream->config.scale_input) {
+    AOM_CODEC_CONTROL_TYPECHECKED(&stream->encoder, AV1E_SET_SCALE_INPUT,
+                                  stream->config.scale_input);
+    ctx_exit_on_error(&stream->encoder, "Failed to enable input scaling");
+  }
 
   if (stream->config.film_grain_filename) {
     AOM_CODEC_CONTROL_TYPECHECKED(&stream->encoder, AV1E_SET_FILM_GRAIN_TABLE,
@@ -1640,8 +1652,8 @@ static void encode_frame(struct stream_state *stream,
       (cfg->g_timebase.den * (int64_t)(frames_in)*global->framerate.den) /
       cfg->g_timebase.num / global->framerate.num;
 
-  /* Scale if necessary */
-  if (img) {
+  /* Scale if necessary, unless the encoder does it */
+  if (img && !stream->config.scale_input) {
     if ((img->fmt & AOM_IMG_FMT_HIGHBITDEPTH) &&
         (img->d_w != cfg->g_w || img->d_h != cfg->g_h)) {
       if (img->fmt != AOM_IMG_FMT_I42016) {
@@ -1677,7 +1689,8 @@ static void encode_frame(struct stream_state *stream,
 #endif
     }
   }
-  if (img && (img->d_w != cfg->g_w || img->d_h != cfg->g_h)) {
+  if (img && !stream->config.scale_input &&
+      (img->d_w != cfg->g_w || img->d_h != cfg->g_h)) {
     if (img->fmt != AOM_IMG_FMT_I420 && img->fmt != AOM_IMG_FMT_YV12) {
       fprintf(stderr, "%s can only scale 4:2:0 8bpp inputs\n", exec_name);
       exit(EXIT_FAILURE);
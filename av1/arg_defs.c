@@ -195,6 +195,10 @@ const av1_codec_arg_definitions_t g_av1_codec_arg_defs = {
                                         "Chroma subsampling x value"),
   .input_chroma_subsampling_y = ARG_DEF(NULL, "input-chroma-subsampling-y", 1,
                                         "Chroma subsampling y value"),
+  .scale_input =
+      ARG_DEF(NULL, "scale-input", 1,
+              "Scale input frames of a different size to --width and "
+              "--height inside the encoder (0: off (default), 1: on)"),
 
   .usage = ARG_DEF("u", "usage", 1,
                    "Usage profile number to use (0: good, 1: rt, 2: allintra)"),
@@ -318,6 +322,10 @@ const av1_codec_arg_definitions_t g_av1_codec_arg_defs = {
       ARG_DEF(NULL, "tile-rows", 1, "Number of tile rows to use, log2"),
   .auto_tiles = ARG_DEF(NULL, "auto-tiles", 1,
                         "Enable auto tiles (0: false (default), 1: true)"),
+  .target_decoder_threads =
+      ARG_DEF(NULL, "target-decoder-threads", 1,
+              "Tune for fast decoding on this many decoder threads "
+              "(0: off (default))"),
   .enable_tpl_model = ARG_DEF(NULL, "enable-tpl-model", 1,
                               "RDO based on frame temporal dependency "
                               "(0: off, 1: backward source based); "
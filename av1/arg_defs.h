@@ -63,6 +63,7 @@ typedef struct av1_codec_arg_definitions {
   arg_def_t inbitdeptharg;
   arg_def_t input_chroma_subsampling_x;
   arg_def_t input_chroma_subsampling_y;
+  arg_def_t scale_input;
   arg_def_t usage;
   arg_def_t threads;
   arg_def_t profile;
@@ -125,6 +126,7 @@ typedef struct av1_codec_arg_definitions {
   arg_def_t tile_cols;
   arg_def_t tile_rows;
   arg_def_t auto_tiles;
+  arg_def_t target_decoder_threads;
   arg_def_t enable_tpl_model;
   arg_def_t enable_keyframe_filtering;
   arg_def_t tile_width;
@@ -131,6 +131,8 @@ list(APPEND AOM_AV1_ENCODER_SOURCES
             "${AOM_ROOT}/av1/encoder/bitstream.c"
             "${AOM_ROOT}/av1/encoder/bitstream.h"
             "${AOM_ROOT}/av1/encoder/block.h"
+            "${AOM_ROOT}/av1/encoder/checkpoint.c"
+            "${AOM_ROOT}/av1/encoder/checkpoint.h"
             "${AOM_ROOT}/av1/encoder/cnn.c"
             "${AOM_ROOT}/av1/encoder/cnn.h"
             "${AOM_ROOT}/av1/encoder/compound_type.c"
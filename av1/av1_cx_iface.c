@@ -34,6 +34,7 @@
 #include "av1/common/enums.h"
 #include "av1/common/scale.h"
 #include "av1/encoder/bitstream.h"
+#include "av1/encoder/checkpoint.h"
 #include "av1/encoder/enc_enums.h"
 #include "av1/encoder/encoder.h"
 #include "av1/encoder/encoder_alloc.h"
@@ -60,6 +61,7 @@ struct av1_extracfg {
   unsigned int tile_columns;  // log2 number of tile columns
   unsigned int tile_rows;     // log2 number of tile rows
   unsigned int auto_tiles;
+  unsigned int target_decoder_threads;
   unsigned int enable_tpl_model;
   unsigned int enable_keyframe_filtering;
   unsigned int arnr_max_frames;
@@ -166,6 +168,7 @@ struct av1_extracfg {
 
   unsigned int chroma_subsampling_x;
   unsigned int chroma_subsampling_y;
+  unsigned int scale_input;
   int reduced_tx_type_set;
   int use_intra_dct_only;
   int use_inter_dct_only;
@@ -229,6 +232,7 @@ static const struct av1_extracfg default_extra_cfg[] = {
       0,                       // tile_columns
       0,                       // tile_rows
       0,                       // auto_tiles
+      0,                       // target_decoder_threads
       1,                       // enable_tpl_model
       1,                       // enable_keyframe_filtering
       7,                       // arnr_max_frames
@@ -332,6 +336,7 @@ static const struct av1_extracfg default_extra_cfg[] = {
 #endif
       0,  // chroma_subsampling_x
       0,  // chroma_subsampling_y
+      0,  // scale_input
       0,  // reduced_tx_type_set
       0,  // use_intra_dct_only
       0,  // use_inter_dct_only
@@ -382,6 +387,7 @@ static const struct av1_extracfg default_extra_cfg[] = {
       0,                   // tile_columns
       0,                   // tile_rows
       0,                   // auto_tiles
+      0,                   // target_decoder_threads
       0,                   // enable_tpl_model
       0,                   // enable_keyframe_filtering
       7,                   // arnr_max_frames
@@ -485,6 +491,7 @@ static const struct av1_extracfg default_extra_cfg[] = {
 #endif
       0,  // chroma_subsampling_x
       0,  // chroma_subsampling_y
+      0,  // scale_input
       0,  // reduced_tx_type_set
       0,  // use_intra_dct_only
       0,  // use_inter_dct_only
@@ -746,6 +753,7 @@ static aom_codec_err_t validate_config(aom_codec_alg_priv_t *ctx,
   RANGE_CHECK_HI(extra_cfg, tile_columns, 6);
   RANGE_CHECK_HI(extra_cfg, tile_rows, 6);
   RANGE_CHECK_HI(extra_cfg, auto_tiles, 1);
+  RANGE_CHECK_HI(extra_cfg, target_decoder_threads, MAX_NUM_THREADS);
 
   RANGE_CHECK_HI(cfg, monochrome, 1);
 
@@ -870,6 +878,7 @@ static aom_codec_err_t validate_config(aom_codec_alg_priv_t *ctx,
   RANGE_CHECK(extra_cfg, enable_reduced_reference_set, 0, 1);
   RANGE_CHECK_HI(extra_cfg, chroma_subsampling_x, 1);
   RANGE_CHECK_HI(extra_cfg, chroma_subsampling_y, 1);
+  RANGE_CHECK_HI(extra_cfg, scale_input, 1);
 
   RANGE_CHECK_HI(extra_cfg, disable_trellis_quant, 3);
   RANGE_CHECK(extra_cfg, coeff_cost_upd_freq, 0, 3);
@@ -936,7 +945,8 @@ static aom_codec_err_t validate_img(aom_codec_alg_priv_t *ctx,
       break;
   }
 
-  if (img->d_w != ctx->cfg.g_w || img->d_h != ctx->cfg.g_h)
+  if (!ctx->extra_cfg.scale_input &&
+      (img->d_w != ctx->cfg.g_w || img->d_h != ctx->cfg.g_h))
     ERROR("Image size must match encoder init configuration size");
 
 #if CONFIG_TUNE_BUTTERAUGLI
@@ -1114,6 +1124,7 @@ static void set_encoder_config(AV1EncoderConfig *oxcf,
   }
   input_cfg->chroma_subsampling_x = extra_cfg->chroma_subsampling_x;
   input_cfg->chroma_subsampling_y = extra_cfg->chroma_subsampling_y;
+  input_cfg->scale_input = extra_cfg->scale_input;
   if (input_cfg->init_framerate > 180) {
     input_cfg->init_framerate = 30;
     dec_model_cfg->timing_info_present = 0;
@@ -1331,6 +1342,7 @@ static void set_encoder_config(AV1EncoderConfig *oxcf,
     tune_cfg->film_grain_table_filename = extra_cfg->film_grain_table_filename;
   }
   tune_cfg->dist_metric = extra_cfg->dist_metric;
+  tune_cfg->target_decoder_threads = extra_cfg->target_decoder_threads;
 #if CONFIG_DENOISE
   oxcf->noise_level = extra_cfg->noise_level;
   oxcf->noise_block_size = extra_cfg->noise_block_size;
@@ -1359,6 +1371,15 @@ static void set_encoder_config(AV1EncoderConfig *oxcf,
     set_auto_tiles(tile_cfg, cfg->g_w, cfg->g_h, cfg->g_threads);
     extra_cfg->tile_columns = tile_cfg->tile_columns;
     extra_cfg->tile_rows = tile_cfg->tile_rows;
+  } else if (extra_cfg->target_decoder_threads &&
+             extra_cfg->tile_columns == 0 && extra_cfg->tile_rows == 0 &&
+             !cfg->large_scale_tile) {
+    // Tiles are the unit of parallelism of the decoder, so aim for one tile
+    // per decoder thread.
+    tile_cfg->tile_columns = 0;
+    tile_cfg->tile_rows = 0;
+    set_auto_tiles(tile_cfg, cfg->g_w, cfg->g_h,
+                   extra_cfg->target_decoder_threads);
   } else {
     tile_cfg->tile_columns = extra_cfg->tile_columns;
     tile_cfg->tile_rows = extra_cfg->tile_rows;
@@ -2713,6 +2734,14 @@ static aom_codec_err_t ctrl_set_auto_tiles(aom_codec_alg_priv_t *ctx,
   return update_extra_cfg(ctx, &extra_cfg);
 }
 
+static aom_codec_err_t ctrl_set_target_decoder_threads(
+    aom_codec_alg_priv_t *ctx, va_list args) {
+  struct av1_extracfg extra_cfg = ctx->extra_cfg;
+  extra_cfg.target_decoder_threads =
+      CAST(AV1E_SET_TARGET_DECODER_THREADS, args);
+  return update_extra_cfg(ctx, &extra_cfg);
+}
+
 static aom_codec_err_t ctrl_set_postencode_drop_rtc(aom_codec_alg_priv_t *ctx,
                                                     va_list args) {
   AV1_PRIMARY *const ppi = ctx->ppi;
@@ -3702,11 +3731,16 @@ static aom_codec_err_t ctrl_use_reference(aom_codec_alg_priv_t *ctx,
 
 static aom_codec_err_t ctrl_set_roi_map(aom_codec_alg_priv_t *ctx,
                                         va_list args) {
-  (void)ctx;
-  (void)args;
+  aom_roi_map_t *const roi = va_arg(args, aom_roi_map_t *);
 
-  // TODO(yaowu): Need to re-implement and test for AV1.
-  return AOM_CODEC_INVALID_PARAM;
+  if (roi) {
+    if (!av1_set_roi_map(ctx->ppi->cpi, roi))
+      return AOM_CODEC_OK;
+    else
+      return AOM_CODEC_INVALID_PARAM;
+  } else {
+    return AOM_CODEC_INVALID_PARAM;
+  }
 }
 
 static aom_codec_err_t ctrl_set_active_map(aom_codec_alg_priv_t *ctx,
@@ -3997,6 +4031,42 @@ static aom_codec_err_t ctrl_set_chroma_subsampling_y(aom_codec_alg_priv_t *ctx,
   return update_extra_cfg(ctx, &extra_cfg);
 }
 
+static aom_codec_err_t ctrl_set_scale_input(aom_codec_alg_priv_t *ctx,
+                                            va_list args) {
+  struct av1_extracfg extra_cfg = ctx->extra_cfg;
+  extra_cfg.scale_input = CAST(AV1E_SET_SCALE_INPUT, args);
+  return update_extra_cfg(ctx, &extra_cfg);
+}
+
+// Contents of the buffers of AV1E_GET_CHECKPOINT and AV1E_SET_CHECKPOINT.
+typedef struct {
+  AV1Checkpoint enc;
+  aom_codec_pts_t pts_offset;
+  unsigned char pts_offset_initialized;
+} EncoderCheckpoint;
+
+static aom_codec_err_t ctrl_set_checkpoint(aom_codec_alg_priv_t *ctx,
+                                           va_list args) {
+  const aom_fixed_buf_t *const arg = va_arg(args, const aom_fixed_buf_t *);
+  if (arg == NULL || arg->buf == NULL || arg->sz != sizeof(EncoderCheckpoint))
+    return AOM_CODEC_INVALID_PARAM;
+  if (ctx->pts_offset_initialized) {
+    ctx->base.err_detail = "Checkpoint must be restored before the first frame";
+    return AOM_CODEC_ERROR;
+  }
+  EncoderCheckpoint checkpoint;
+  memcpy(&checkpoint, arg->buf, sizeof(checkpoint));
+  const aom_codec_err_t res =
+      av1_restore_checkpoint(ctx->ppi, &checkpoint.enc);
+  if (res != AOM_CODEC_OK) {
+    ctx->base.err_detail = "Checkpoint does not match the encoder";
+    return res;
+  }
+  ctx->pts_offset = checkpoint.pts_offset;
+  ctx->pts_offset_initialized = checkpoint.pts_offset_initialized;
+  return AOM_CODEC_OK;
+}
+
 static aom_codec_err_t encoder_set_option(aom_codec_alg_priv_t *ctx,
                                           const char *name, const char *value) {
   if (ctx == NULL || name == NULL || value == NULL)
@@ -4081,6 +4151,10 @@ static aom_codec_err_t encoder_set_option(aom_codec_alg_priv_t *ctx,
   } else if (arg_match_helper(&arg, &g_av1_codec_arg_defs.auto_tiles, argv,
                               err_string)) {
     extra_cfg.auto_tiles = arg_parse_uint_helper(&arg, err_string);
+  } else if (arg_match_helper(&arg,
+                              &g_av1_codec_arg_defs.target_decoder_threads,
+                              argv, err_string)) {
+    extra_cfg.target_decoder_threads = arg_parse_uint_helper(&arg, err_string);
   } else if (arg_match_helper(&arg, &g_av1_codec_arg_defs.enable_tpl_model,
                               argv, err_string)) {
     extra_cfg.enable_tpl_model = arg_parse_uint_helper(&arg, err_string);
@@ -4424,6 +4498,9 @@ static aom_codec_err_t encoder_set_option(aom_codec_alg_priv_t *ctx,
                               &g_av1_codec_arg_defs.input_chroma_subsampling_y,
                               argv, err_string)) {
     extra_cfg.chroma_subsampling_y = arg_parse_uint_helper(&arg, err_string);
+  } else if (arg_match_helper(&arg, &g_av1_codec_arg_defs.scale_input, argv,
+                              err_string)) {
+    extra_cfg.scale_input = arg_parse_uint_helper(&arg, err_string);
   } else if (arg_match_helper(&arg, &g_av1_codec_arg_defs.passes, argv,
                               err_string)) {
     extra_cfg.passes = arg_parse_int_helper(&arg, err_string);
@@ -4530,6 +4607,37 @@ static aom_codec_err_t ctrl_get_high_motion_content_screen_rtc(
   return AOM_CODEC_OK;
 }
 
+static aom_codec_err_t ctrl_get_predicted_decode_time(
+    aom_codec_alg_priv_t *ctx, va_list args) {
+  int *arg = va_arg(args, int *);
+  if (arg == NULL) return AOM_CODEC_INVALID_PARAM;
+  *arg = ctx->ppi->predicted_decode_time_us;
+  return AOM_CODEC_OK;
+}
+
+static aom_codec_err_t ctrl_get_checkpoint(aom_codec_alg_priv_t *ctx,
+                                           va_list args) {
+  aom_fixed_buf_t *const arg = va_arg(args, aom_fixed_buf_t *);
+  if (arg == NULL) return AOM_CODEC_INVALID_PARAM;
+  EncoderCheckpoint *const checkpoint =
+      (EncoderCheckpoint *)malloc(sizeof(*checkpoint));
+  if (checkpoint == NULL) return AOM_CODEC_MEM_ERROR;
+  const aom_codec_err_t res = av1_save_checkpoint(ctx->ppi, &checkpoint->enc);
+  if (res != AOM_CODEC_OK) {
+    free(checkpoint);
+    ctx->base.err_detail =
+        res == AOM_CODEC_INCAPABLE
+            ? "Checkpoints need the second pass of a two-pass encode"
+            : "The next frame does not start a key frame group";
+    return res;
+  }
+  checkpoint->pts_offset = ctx->pts_offset;
+  checkpoint->pts_offset_initialized = ctx->pts_offset_initialized;
+  arg->buf = checkpoint;
+  arg->sz = sizeof(*checkpoint);
+  return AOM_CODEC_OK;
+}
+
 static aom_codec_ctrl_fn_map_t encoder_ctrl_maps[] = {
   { AV1_COPY_REFERENCE, ctrl_copy_reference },
   { AOME_USE_REFERENCE, ctrl_use_reference },
@@ -4680,6 +4788,9 @@ static aom_codec_ctrl_fn_map_t encoder_ctrl_maps[] = {
   { AV1E_SET_POSTENCODE_DROP_RTC, ctrl_set_postencode_drop_rtc },
   { AV1E_SET_MAX_CONSEC_FRAME_DROP_MS_CBR,
     ctrl_set_max_consec_frame_drop_ms_cbr },
+  { AV1E_SET_TARGET_DECODER_THREADS, ctrl_set_target_decoder_threads },
+  { AV1E_SET_SCALE_INPUT, ctrl_set_scale_input },
+  { AV1E_SET_CHECKPOINT, ctrl_set_checkpoint },
 
   // Getters
   { AOME_GET_LAST_QUANTIZER, ctrl_get_quantizer },
@@ -4698,6 +4809,8 @@ static aom_codec_ctrl_fn_map_t encoder_ctrl_maps[] = {
   { AV1E_GET_LUMA_CDEF_STRENGTH, ctrl_get_luma_cdef_strength },
   { AV1E_GET_HIGH_MOTION_CONTENT_SCREEN_RTC,
     ctrl_get_high_motion_content_screen_rtc },
+  { AV1E_GET_PREDICTED_DECODE_TIME, ctrl_get_predicted_decode_time },
+  { AV1E_GET_CHECKPOINT, ctrl_get_checkpoint },
 
   CTRL_MAP_END,
 };
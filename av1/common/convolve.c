@@ -134,6 +134,73 @@ void av1_convolve_2d_sr_c(const uint8_t *src, int src_stride, uint8_t *dst,
   }
 }
 
+static inline int im_block_index(int h, int x, int y) {
+  return (x >> 3) * CONVOLVE_2D_SR_IM_STRIPE_SIZE(h) + y * 8 + (x & 7);
+}
+
+// First (horizontal) pass of av1_convolve_2d_sr_c(), restricted to 8-tap
+// filters. Writes the h + SUBPEL_TAPS - 1 rows needed by the vertical pass in
+// the CONVOLVE_2D_SR_IM_STRIPE_SIZE() layout.
+void av1_convolve_2d_sr_horiz_c(const uint8_t *src, int src_stride,
+                                int16_t *im_block, int w, int h,
+                                const InterpFilterParams *filter_params_x,
+                                const int subpel_x_qn,
+                                ConvolveParams *conv_params) {
+  assert(filter_params_x->taps == SUBPEL_TAPS);
+  assert(w <= MAX_SB_SIZE && h <= MAX_SB_SIZE);
+  const int im_h = h + SUBPEL_TAPS - 1;
+  const int fo_vert = SUBPEL_TAPS / 2 - 1;
+  const int fo_horiz = SUBPEL_TAPS / 2 - 1;
+  const int bd = 8;
+
+  const uint8_t *src_horiz = src - fo_vert * src_stride;
+  const int16_t *x_filter = av1_get_interp_filter_subpel_kernel(
+      filter_params_x, subpel_x_qn & SUBPEL_MASK);
+  for (int y = 0; y < im_h; ++y) {
+    for (int x = 0; x < w; ++x) {
+      int32_t sum = (1 << (bd + FILTER_BITS - 1));
+      for (int k = 0; k < SUBPEL_TAPS; ++k) {
+        sum += x_filter[k] * src_horiz[y * src_stride + x - fo_horiz + k];
+      }
+      assert(0 <= sum && sum < (1 << (bd + FILTER_BITS + 1)));
+      im_block[im_block_index(h, x, y)] =
+          (int16_t)ROUND_POWER_OF_TWO(sum, conv_params->round_0);
+    }
+  }
+}
+
+// Second (vertical) pass of av1_convolve_2d_sr_c(), reading the output of
+// av1_convolve_2d_sr_horiz().
+void av1_convolve_2d_sr_vert_c(const int16_t *im_block, uint8_t *dst,
+                               int dst_stride, int w, int h,
+                               const InterpFilterParams *filter_params_y,
+                               const int subpel_y_qn,
+                               ConvolveParams *conv_params) {
+  assert(filter_params_y->taps == SUBPEL_TAPS);
+  assert(w <= MAX_SB_SIZE && h <= MAX_SB_SIZE);
+  const int bd = 8;
+  const int bits =
+      FILTER_BITS * 2 - conv_params->round_0 - conv_params->round_1;
+  const int offset_bits = bd + 2 * FILTER_BITS - conv_params->round_0;
+
+  const int16_t *y_filter = av1_get_interp_filter_subpel_kernel(
+      filter_params_y, subpel_y_qn & SUBPEL_MASK);
+  for (int y = 0; y < h; ++y) {
+    for (int x = 0; x < w; ++x) {
+      const int16_t *src_vert = im_block + im_block_index(h, x, y);
+      int32_t sum = 1 << offset_bits;
+      for (int k = 0; k < SUBPEL_TAPS; ++k) {
+        sum += y_filter[k] * src_vert[k * 8];
+      }
+      assert(0 <= sum && sum < (1 << (offset_bits + 2)));
+      int16_t res = ROUND_POWER_OF_TWO(sum, conv_params->round_1) -
+                    ((1 << (offset_bits - conv_params->round_1)) +
+                     (1 << (offset_bits - conv_params->round_1 - 1)));
+      dst[y * dst_stride + x] = clip_pixel(ROUND_POWER_OF_TWO(res, bits));
+    }
+  }
+}
+
 void av1_convolve_y_sr_c(const uint8_t *src, int src_stride, uint8_t *dst,
                          int dst_stride, int w, int h,
                          const InterpFilterParams *filter_params_y,
@@ -42,6 +42,15 @@ typedef struct WienerConvolveParams {
 
 #define WIENER_CLAMP_LIMIT(r0, bd) (1 << ((bd) + 1 + FILTER_BITS - r0))
 
+// Intermediate buffer layout shared by av1_convolve_2d_sr_horiz() and
+// av1_convolve_2d_sr_vert(). The horizontally filtered block is stored as
+// 8-pixel wide column stripes, each holding (h + SUBPEL_TAPS) rows, so that the
+// two passes of av1_convolve_2d_sr() can be run (and the first one reused)
+// separately.
+#define CONVOLVE_2D_SR_IM_STRIPE_SIZE(h) (((h) + SUBPEL_TAPS) * 8)
+#define CONVOLVE_2D_SR_IM_BLOCK_SIZE \
+  ((MAX_SB_SIZE / 8) * CONVOLVE_2D_SR_IM_STRIPE_SIZE(MAX_SB_SIZE))
+
 typedef void (*aom_convolve_fn_t)(const uint8_t *src, int src_stride,
                                   uint8_t *dst, int dst_stride, int w, int h,
                                   const InterpFilterParams *filter_params_x,
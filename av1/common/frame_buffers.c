@@ -13,6 +13,7 @@
 
 #include "av1/common/frame_buffers.h"
 #include "aom_mem/aom_mem.h"
+#include "aom_scale/yv12config.h"
 
 int av1_alloc_internal_frame_buffers(InternalFrameBufferList *list) {
   assert(list != NULL);
@@ -44,14 +45,16 @@ void av1_free_internal_frame_buffers(InternalFrameBufferList *list) {
 }
 
 void av1_zero_unused_internal_frame_buffers(InternalFrameBufferList *list) {
-  int i;
-
   assert(list != NULL);
 
-  for (i = 0; i < list->num_internal_frame_buffers; ++i) {
+#if AOM_ZERO_FILL_FRAME_BUFFERS
+  for (int i = 0; i < list->num_internal_frame_buffers; ++i) {
     if (list->int_fb[i].data && !list->int_fb[i].in_use)
       memset(list->int_fb[i].data, 0, list->int_fb[i].size);
   }
+#else
+  (void)list;
+#endif
 }
 
 int av1_get_frame_buffer(void *cb_priv, size_t min_size,
@@ -70,10 +73,13 @@ int av1_get_frame_buffer(void *cb_priv, size_t min_size,
 
   if (int_fb_list->int_fb[i].size < min_size) {
     aom_free(int_fb_list->int_fb[i].data);
-    // The data must be zeroed to fix a valgrind error from the C loop filter
-    // due to access uninitialized memory in frame border. It could be
-    // skipped if border were totally removed.
+    // Pixels outside the frame never reach the decoder output, so the data
+    // is only zeroed in builds that check for reads of uninitialized memory.
+#if AOM_ZERO_FILL_FRAME_BUFFERS
     int_fb_list->int_fb[i].data = (uint8_t *)aom_calloc(1, min_size);
+#else
+    int_fb_list->int_fb[i].data = (uint8_t *)aom_malloc(min_size);
+#endif
     if (!int_fb_list->int_fb[i].data) {
       int_fb_list->int_fb[i].size = 0;
       return -1;
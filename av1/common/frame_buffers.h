@@ -36,8 +36,9 @@ int av1_alloc_internal_frame_buffers(InternalFrameBufferList *list);
 // Free any data allocated to the frame buffers.
 void av1_free_internal_frame_buffers(InternalFrameBufferList *list);
 
-// Zeros all unused internal frame buffers. In particular, this zeros the
-// frame borders. Call this function after a sequence header change to
+// Zeros all unused internal frame buffers when AOM_ZERO_FILL_FRAME_BUFFERS is
+// set, and does nothing otherwise. In particular, this zeros the frame
+// borders. Call this function after a sequence header change to
 // re-initialize the frame borders for the different width, height, or bit
 // depth.
 void av1_zero_unused_internal_frame_buffers(InternalFrameBufferList *list);
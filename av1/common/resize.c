@@ -1116,9 +1116,10 @@ bool av1_resize_and_extend_frame_nonnormative(const YV12_BUFFER_CONFIG *src,
   return true;
 }
 
-void av1_upscale_normative_rows(const AV1_COMMON *cm, const uint8_t *src,
-                                int src_stride, uint8_t *dst, int dst_stride,
-                                int plane, int rows) {
+static void upscale_normative_rows(const AV1_COMMON *cm, const uint8_t *src,
+                                   int src_stride, uint8_t *dst,
+                                   int dst_stride, int plane, int rows,
+                                   struct aom_internal_error_info *error_info) {
   const int is_uv = (plane > 0);
   const int ss_x = is_uv && cm->seq_params->subsampling_x;
   const int downscaled_plane_width = ROUND_POWER_OF_TWO(cm->width, ss_x);
@@ -1178,7 +1179,7 @@ void av1_upscale_normative_rows(const AV1_COMMON *cm, const uint8_t *src,
                                      x_step_qn, x0_qn, pad_left, pad_right);
 #endif
     if (!success) {
-      aom_internal_error(cm->error, AOM_CODEC_MEM_ERROR,
+      aom_internal_error(error_info, AOM_CODEC_MEM_ERROR,
                          "Error upscaling frame");
     }
     // Update the fractional pixel offset to prepare for the next tile column.
@@ -1186,18 +1187,31 @@ void av1_upscale_normative_rows(const AV1_COMMON *cm, const uint8_t *src,
   }
 }
 
-static void upscale_normative_and_extend_frame(const AV1_COMMON *cm,
-                                               const YV12_BUFFER_CONFIG *src,
-                                               YV12_BUFFER_CONFIG *dst) {
-  const int num_planes = av1_num_planes(cm);
-  for (int i = 0; i < num_planes; ++i) {
-    const int is_uv = (i > 0);
-    av1_upscale_normative_rows(cm, src->buffers[i], src->strides[is_uv],
-                               dst->buffers[i], dst->strides[is_uv], i,
-                               src->crop_heights[is_uv]);
-  }
+void av1_upscale_normative_rows(const AV1_COMMON *cm, const uint8_t *src,
+                                int src_stride, uint8_t *dst, int dst_stride,
+                                int plane, int rows) {
+  upscale_normative_rows(cm, src, src_stride, dst, dst_stride, plane, rows,
+                         cm->error);
+}
 
-  aom_extend_frame_borders(dst, num_planes);
+void av1_superres_upscale_plane_rows(const AV1_COMMON *cm,
+                                     const YV12_BUFFER_CONFIG *src,
+                                     YV12_BUFFER_CONFIG *dst, int plane,
+                                     int row_start, int row_end,
+                                     struct aom_internal_error_info *error_info) {
+  const int is_uv = (plane > 0);
+  assert(row_start >= 0 && row_start < row_end);
+  assert(row_end <= src->crop_heights[is_uv]);
+  assert(src->crop_heights[is_uv] == dst->crop_heights[is_uv]);
+  // Each call touches only the rows it upscales (the left/right padding done
+  // by upscale_normative_rect() is restored before returning), so disjoint
+  // row ranges may be processed concurrently.
+  upscale_normative_rows(
+      cm, src->buffers[plane] + (ptrdiff_t)row_start * src->strides[is_uv],
+      src->strides[is_uv],
+      dst->buffers[plane] + (ptrdiff_t)row_start * dst->strides[is_uv],
+      dst->strides[is_uv], plane, row_end - row_start, error_info);
+  aom_extend_frame_borders_plane_row(dst, plane, row_start, row_end);
 }
 
 YV12_BUFFER_CONFIG *av1_realloc_and_scale_if_required(
@@ -1306,37 +1320,16 @@ static void copy_buffer_config(const YV12_BUFFER_CONFIG *const src,
   dst->color_range = src->color_range;
 }
 
-// TODO(afergs): Look for in-place upscaling
-// TODO(afergs): aom_ vs av1_ functions? Which can I use?
-// Upscale decoded image.
-void av1_superres_upscale(AV1_COMMON *cm, BufferPool *const pool,
-                          bool alloc_pyramid) {
+void av1_superres_alloc_upscaled_frame(AV1_COMMON *cm, BufferPool *const pool,
+                                       bool alloc_pyramid,
+                                       SuperresSource *src) {
   const int num_planes = av1_num_planes(cm);
-  if (!av1_superres_scaled(cm)) return;
   const SequenceHeader *const seq_params = cm->seq_params;
   const int byte_alignment = cm->features.byte_alignment;
 
-  YV12_BUFFER_CONFIG copy_buffer;
-  memset(&copy_buffer, 0, sizeof(copy_buffer));
-
   YV12_BUFFER_CONFIG *const frame_to_show = &cm->cur_frame->buf;
+  memset(src, 0, sizeof(*src));
 
-  const int aligned_width = ALIGN_POWER_OF_TWO(cm->width, 3);
-  if (aom_alloc_frame_buffer(
-          &copy_buffer, aligned_width, cm->height, seq_params->subsampling_x,
-          seq_params->subsampling_y, seq_params->use_highbitdepth,
-          AOM_BORDER_IN_PIXELS, byte_alignment, false, 0))
-    aom_internal_error(cm->error, AOM_CODEC_MEM_ERROR,
-                       "Failed to allocate copy buffer for superres upscaling");
-
-  // Copy function assumes the frames are the same size.
-  // Note that it does not copy YV12_BUFFER_CONFIG config data.
-  aom_yv12_copy_frame(frame_to_show, &copy_buffer, num_planes);
-
-  assert(copy_buffer.y_crop_width == aligned_width);
-  assert(copy_buffer.y_crop_height == cm->height);
-
-  // Realloc the current frame buffer at a higher resolution in place.
   if (pool != NULL) {
     // Use callbacks if on the decoder.
     aom_codec_frame_buffer_t *fb = &cm->cur_frame->raw_frame_buffer;
@@ -1344,10 +1337,53 @@ void av1_superres_upscale(AV1_COMMON *cm, BufferPool *const pool,
     aom_get_frame_buffer_cb_fn_t cb = pool->get_fb_cb;
     void *cb_priv = pool->cb_priv;
 
+    // Preferably, take a second buffer from the pool for the upscaled frame
+    // and keep reading from the one the frame was decoded into. This avoids
+    // copying the whole downscaled frame before upscaling.
+    lock_buffer_pool(pool);
+    YV12_BUFFER_CONFIG upscaled = *frame_to_show;
+    aom_codec_frame_buffer_t upscaled_fb;
+    memset(&upscaled_fb, 0, sizeof(upscaled_fb));
+    if (!aom_realloc_frame_buffer(
+            &upscaled, cm->superres_upscaled_width,
+            cm->superres_upscaled_height, seq_params->subsampling_x,
+            seq_params->subsampling_y, seq_params->use_highbitdepth,
+            AOM_BORDER_IN_PIXELS, byte_alignment, &upscaled_fb, cb, cb_priv,
+            alloc_pyramid, 0)) {
+      unlock_buffer_pool(pool);
+      src->buf = *frame_to_show;
+      src->raw_frame_buffer = *fb;
+      src->in_pool = true;
+      *frame_to_show = upscaled;
+      *fb = upscaled_fb;
+      return;
+    }
+    // The pool could not provide another buffer. Fall back to upscaling from
+    // a private copy of the downscaled frame.
+    if (upscaled_fb.data != NULL) release_fb_cb(cb_priv, &upscaled_fb);
+    unlock_buffer_pool(pool);
+
+    const int aligned_width = ALIGN_POWER_OF_TWO(cm->width, 3);
+    if (aom_alloc_frame_buffer(
+            &src->buf, aligned_width, cm->height, seq_params->subsampling_x,
+            seq_params->subsampling_y, seq_params->use_highbitdepth,
+            AOM_BORDER_IN_PIXELS, byte_alignment, false, 0))
+      aom_internal_error(
+          cm->error, AOM_CODEC_MEM_ERROR,
+          "Failed to allocate copy buffer for superres upscaling");
+
+    // Copy function assumes the frames are the same size.
+    // Note that it does not copy YV12_BUFFER_CONFIG config data.
+    aom_yv12_copy_frame(frame_to_show, &src->buf, num_planes);
+
+    assert(src->buf.y_crop_width == aligned_width);
+    assert(src->buf.y_crop_height == cm->height);
+
     lock_buffer_pool(pool);
     // Realloc with callback does not release the frame buffer - release first.
     if (release_fb_cb(cb_priv, fb)) {
       unlock_buffer_pool(pool);
+      aom_free_frame_buffer(&src->buf);
       aom_internal_error(
           cm->error, AOM_CODEC_MEM_ERROR,
           "Failed to free current frame buffer before superres upscaling");
@@ -1360,40 +1396,65 @@ void av1_superres_upscale(AV1_COMMON *cm, BufferPool *const pool,
             AOM_BORDER_IN_PIXELS, byte_alignment, fb, cb, cb_priv,
             alloc_pyramid, 0)) {
       unlock_buffer_pool(pool);
+      aom_free_frame_buffer(&src->buf);
       aom_internal_error(
           cm->error, AOM_CODEC_MEM_ERROR,
           "Failed to allocate current frame buffer for superres upscaling");
     }
     unlock_buffer_pool(pool);
   } else {
-    // Make a copy of the config data for frame_to_show in copy_buffer
-    copy_buffer_config(frame_to_show, &copy_buffer);
-
-    // Don't use callbacks on the encoder.
-    // aom_alloc_frame_buffer() clears the config data for frame_to_show
+    // Don't use callbacks on the encoder. Hand the downscaled frame (and its
+    // allocation) over to 'src' and allocate frame_to_show afresh.
+    src->buf = *frame_to_show;
+    memset(frame_to_show, 0, sizeof(*frame_to_show));
     if (aom_alloc_frame_buffer(
             frame_to_show, cm->superres_upscaled_width,
             cm->superres_upscaled_height, seq_params->subsampling_x,
             seq_params->subsampling_y, seq_params->use_highbitdepth,
-            AOM_BORDER_IN_PIXELS, byte_alignment, alloc_pyramid, 0))
+            AOM_BORDER_IN_PIXELS, byte_alignment, alloc_pyramid, 0)) {
+      aom_free_frame_buffer(&src->buf);
       aom_internal_error(
           cm->error, AOM_CODEC_MEM_ERROR,
           "Failed to reallocate current frame buffer for superres upscaling");
+    }
 
     // Restore config data back to frame_to_show
-    copy_buffer_config(&copy_buffer, frame_to_show);
+    copy_buffer_config(&src->buf, frame_to_show);
   }
-  // TODO(afergs): verify frame_to_show is correct after realloc
-  //               encoder:
-  //               decoder:
 
   assert(frame_to_show->y_crop_width == cm->superres_upscaled_width);
   assert(frame_to_show->y_crop_height == cm->superres_upscaled_height);
+}
+
+void av1_superres_free_source(BufferPool *const pool, SuperresSource *src) {
+  if (src->in_pool) {
+    assert(pool != NULL);
+    lock_buffer_pool(pool);
+    pool->release_fb_cb(pool->cb_priv, &src->raw_frame_buffer);
+    unlock_buffer_pool(pool);
+  } else {
+    aom_free_frame_buffer(&src->buf);
+  }
+  memset(src, 0, sizeof(*src));
+}
+
+// Upscale decoded image.
+void av1_superres_upscale(AV1_COMMON *cm, BufferPool *const pool,
+                          bool alloc_pyramid) {
+  const int num_planes = av1_num_planes(cm);
+  if (!av1_superres_scaled(cm)) return;
+
+  SuperresSource src;
+  av1_superres_alloc_upscaled_frame(cm, pool, alloc_pyramid, &src);
 
   // Scale up and back into frame_to_show.
+  YV12_BUFFER_CONFIG *const frame_to_show = &cm->cur_frame->buf;
   assert(frame_to_show->y_crop_width != cm->width);
-  upscale_normative_and_extend_frame(cm, &copy_buffer, frame_to_show);
+  for (int plane = 0; plane < num_planes; ++plane) {
+    av1_superres_upscale_plane_rows(cm, &src.buf, frame_to_show, plane, 0,
+                                    frame_to_show->crop_heights[plane > 0],
+                                    cm->error);
+  }
 
-  // Free the copy buffer
-  aom_free_frame_buffer(&copy_buffer);
+  av1_superres_free_source(pool, &src);
 }
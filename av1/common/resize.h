@@ -53,6 +53,35 @@ void av1_calculate_scaled_superres_size(int *width, int *height,
 void av1_superres_upscale(AV1_COMMON *cm, BufferPool *const pool,
                           bool alloc_pyramid);
 
+// The downscaled frame that superres upscaling reads from.
+typedef struct SuperresSource {
+  YV12_BUFFER_CONFIG buf;
+  // If true, 'buf' is still backed by the pool frame buffer 'raw_frame_buffer'
+  // it was decoded into. Otherwise 'buf' owns its allocation.
+  bool in_pool;
+  aom_codec_frame_buffer_t raw_frame_buffer;
+} SuperresSource;
+
+// Reallocates cm->cur_frame->buf at the superres upscaled resolution and
+// returns the downscaled frame in 'src'. The pixel data of cm->cur_frame->buf
+// is undefined until av1_superres_upscale_plane_rows() has been called for
+// every row of every plane. 'src' must then be released with
+// av1_superres_free_source().
+void av1_superres_alloc_upscaled_frame(AV1_COMMON *cm, BufferPool *const pool,
+                                       bool alloc_pyramid,
+                                       SuperresSource *src);
+
+// Upscales rows [row_start, row_end) of the given plane from 'src' into 'dst'
+// and extends the borders of those rows. Disjoint row ranges may be upscaled
+// concurrently.
+void av1_superres_upscale_plane_rows(const AV1_COMMON *cm,
+                                     const YV12_BUFFER_CONFIG *src,
+                                     YV12_BUFFER_CONFIG *dst, int plane,
+                                     int row_start, int row_end,
+                                     struct aom_internal_error_info *error_info);
+
+void av1_superres_free_source(BufferPool *const pool, SuperresSource *src);
+
 bool av1_resize_plane_to_half(const uint8_t *const input, int height, int width,
                               int in_stride, uint8_t *output, int height2,
                               int width2, int out_stride);
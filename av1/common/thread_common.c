@@ -26,6 +26,7 @@
 #include "av1/common/thread_common.h"
 #include "av1/common/reconinter.h"
 #include "av1/common/reconintra.h"
+#include "av1/common/resize.h"
 #include "av1/common/restoration.h"
 
 // Set up nsync by width.
@@ -996,6 +997,163 @@ void av1_loop_restoration_filter_frame_mt(YV12_BUFFER_CONFIG *frame,
 }
 #endif  // !CONFIG_REALTIME_ONLY || CONFIG_AV1_DECODER
 
+// Allocate memory for superres upscaling multi-thread synchronization.
+static void superres_sync_alloc(AV1SuperresSync *superres_sync, AV1_COMMON *cm,
+                                int num_workers) {
+#if CONFIG_MULTITHREAD
+  CHECK_MEM_ERROR(cm, superres_sync->job_mutex,
+                  aom_malloc(sizeof(*(superres_sync->job_mutex))));
+  if (superres_sync->job_mutex) {
+    pthread_mutex_init(superres_sync->job_mutex, NULL);
+  }
+#endif  // CONFIG_MULTITHREAD
+  CHECK_MEM_ERROR(
+      cm, superres_sync->workerdata,
+      aom_calloc(num_workers, sizeof(*(superres_sync->workerdata))));
+  superres_sync->num_workers = num_workers;
+}
+
+// Deallocate superres upscaling multi-thread synchronization related mutex and
+// data.
+void av1_superres_sync_dealloc(AV1SuperresSync *superres_sync) {
+  if (superres_sync == NULL) return;
+#if CONFIG_MULTITHREAD
+  if (superres_sync->job_mutex != NULL) {
+    pthread_mutex_destroy(superres_sync->job_mutex);
+    aom_free(superres_sync->job_mutex);
+  }
+#endif  // CONFIG_MULTITHREAD
+  aom_free(superres_sync->workerdata);
+  av1_zero(*superres_sync);
+}
+
+// Checks if a job is available. If so, populates the plane and row range of
+// the job and returns 1, else returns 0.
+static int get_superres_next_job(AV1SuperresSync *superres_sync,
+                                 const AV1_COMMON *cm, int *plane,
+                                 int *v_start, int *v_end) {
+  int do_next_job = 0;
+#if CONFIG_MULTITHREAD
+  pthread_mutex_lock(superres_sync->job_mutex);
+#endif  // CONFIG_MULTITHREAD
+  while (!superres_sync->superres_mt_exit &&
+         superres_sync->next_stripe < superres_sync->num_stripes) {
+    const int cur_plane = superres_sync->next_plane;
+    const int cur_stripe = superres_sync->next_stripe;
+    if (++superres_sync->next_plane == superres_sync->num_planes) {
+      superres_sync->next_plane = 0;
+      superres_sync->next_stripe++;
+    }
+
+    // Use the same stripes as loop restoration, which follows upscaling.
+    const int is_uv = cur_plane > 0;
+    const int ss_y = is_uv && cm->seq_params->subsampling_y;
+    const int stripe_height = RESTORATION_PROC_UNIT_SIZE >> ss_y;
+    const int stripe_off = RESTORATION_UNIT_OFFSET >> ss_y;
+    const int plane_h = cm->cur_frame->buf.crop_heights[is_uv];
+    const int y0 = AOMMAX(0, cur_stripe * stripe_height - stripe_off);
+    if (y0 >= plane_h) continue;
+    *plane = cur_plane;
+    *v_start = y0;
+    *v_end = AOMMIN((cur_stripe + 1) * stripe_height - stripe_off, plane_h);
+    do_next_job = 1;
+    break;
+  }
+#if CONFIG_MULTITHREAD
+  pthread_mutex_unlock(superres_sync->job_mutex);
+#endif  // CONFIG_MULTITHREAD
+  return do_next_job;
+}
+
+// Hook function for each thread in superres upscaling multi-threading.
+static int superres_upscale_row_worker(void *arg1, void *arg2) {
+  AV1SuperresSync *const superres_sync = (AV1SuperresSync *)arg1;
+  AV1SuperresWorkerData *const workerdata = (AV1SuperresWorkerData *)arg2;
+  const AV1_COMMON *const cm = workerdata->cm;
+  struct aom_internal_error_info *const error_info = &workerdata->error_info;
+
+  // The jmp_buf is valid only for the duration of the function that calls
+  // setjmp(). Therefore, this function must reset the 'setjmp' field to 0
+  // before it returns.
+  if (setjmp(error_info->jmp)) {
+    error_info->setjmp = 0;
+#if CONFIG_MULTITHREAD
+    pthread_mutex_lock(superres_sync->job_mutex);
+    superres_sync->superres_mt_exit = true;
+    pthread_mutex_unlock(superres_sync->job_mutex);
+#endif
+    return 0;
+  }
+  error_info->setjmp = 1;
+
+  int plane, v_start, v_end;
+  while (get_superres_next_job(superres_sync, cm, &plane, &v_start, &v_end)) {
+    av1_superres_upscale_plane_rows(cm, workerdata->src, workerdata->dst, plane,
+                                    v_start, v_end, error_info);
+  }
+  error_info->setjmp = 0;
+  return 1;
+}
+
+// Performs superres upscaling of the current frame on the given workers. Each
+// worker upscales whole stripes directly from the downscaled frame into the
+// upscaled frame buffer.
+void av1_superres_upscale_mt(AV1_COMMON *cm, BufferPool *const pool,
+                             AVxWorker *workers, int num_workers,
+                             AV1SuperresSync *superres_sync) {
+  const AVxWorkerInterface *const winterface = aom_get_worker_interface();
+  if (!av1_superres_scaled(cm)) return;
+
+  if (num_workers > superres_sync->num_workers) {
+    av1_superres_sync_dealloc(superres_sync);
+    superres_sync_alloc(superres_sync, cm, num_workers);
+  }
+
+  SuperresSource src;
+  av1_superres_alloc_upscaled_frame(cm, pool, false, &src);
+
+  superres_sync->next_stripe = 0;
+  superres_sync->next_plane = 0;
+  superres_sync->num_planes = av1_num_planes(cm);
+  superres_sync->num_stripes =
+      (cm->superres_upscaled_height + RESTORATION_UNIT_OFFSET +
+       RESTORATION_PROC_UNIT_SIZE - 1) /
+      RESTORATION_PROC_UNIT_SIZE;
+  superres_sync->superres_mt_exit = false;
+
+  for (int i = num_workers - 1; i >= 0; --i) {
+    AVxWorker *const worker = &workers[i];
+    AV1SuperresWorkerData *const workerdata = &superres_sync->workerdata[i];
+    workerdata->cm = cm;
+    workerdata->src = &src.buf;
+    workerdata->dst = &cm->cur_frame->buf;
+    worker->hook = superres_upscale_row_worker;
+    worker->data1 = superres_sync;
+    worker->data2 = workerdata;
+
+    worker->had_error = 0;
+    if (i == 0) {
+      winterface->execute(worker);
+    } else {
+      winterface->launch(worker);
+    }
+  }
+
+  int had_error = workers[0].had_error;
+  struct aom_internal_error_info error_info;
+  if (had_error) error_info = superres_sync->workerdata[0].error_info;
+  for (int i = num_workers - 1; i > 0; --i) {
+    if (!winterface->sync(&workers[i])) {
+      had_error = 1;
+      error_info = superres_sync->workerdata[i].error_info;
+    }
+  }
+  // The downscaled frame is no longer needed, whether or not upscaling
+  // succeeded.
+  av1_superres_free_source(pool, &src);
+  if (had_error) aom_internal_error_copy(cm->error, &error_info);
+}
+
 // Initializes cdef_sync parameters.
 static inline void reset_cdef_job_info(AV1CdefSync *const cdef_sync) {
   cdef_sync->end_of_frame = 0;
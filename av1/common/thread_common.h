@@ -109,6 +109,32 @@ typedef struct AV1LrSyncData {
   bool lr_mt_exit;
 } AV1LrSync;
 
+typedef struct AV1SuperresWorkerData {
+  struct AV1Common *cm;
+  const YV12_BUFFER_CONFIG *src;
+  YV12_BUFFER_CONFIG *dst;
+  struct aom_internal_error_info error_info;
+} AV1SuperresWorkerData;
+
+// Superres upscaling multi-thread synchronization. The frame is upscaled in
+// jobs of one loop restoration processing stripe of one plane each.
+typedef struct AV1SuperresSyncData {
+#if CONFIG_MULTITHREAD
+  // Mutex lock used while dispatching jobs.
+  pthread_mutex_t *job_mutex;
+#endif
+  AV1SuperresWorkerData *workerdata;
+  int num_workers;
+  // Stripe index and plane of the next job.
+  int next_stripe;
+  int next_plane;
+  int num_stripes;
+  int num_planes;
+  // Initialized to false, set to true by the worker thread that encounters
+  // an error in order to abort the processing of other worker threads.
+  bool superres_mt_exit;
+} AV1SuperresSync;
+
 typedef struct AV1CdefWorker {
   AV1_COMMON *cm;
   MACROBLOCKD *xd;
@@ -200,6 +226,11 @@ void av1_loop_restoration_alloc(AV1LrSync *lr_sync, AV1_COMMON *cm,
                                 int num_planes, int width);
 #endif  // !CONFIG_REALTIME_ONLY || CONFIG_AV1_DECODER
 
+void av1_superres_upscale_mt(struct AV1Common *cm, BufferPool *const pool,
+                             AVxWorker *workers, int num_workers,
+                             AV1SuperresSync *superres_sync);
+void av1_superres_sync_dealloc(AV1SuperresSync *superres_sync);
+
 int av1_get_intrabc_extra_top_right_sb_delay(const AV1_COMMON *cm);
 
 void av1_thread_loop_filter_rows(
@@ -165,3 +165,71 @@ void av1_convolve_2d_sr_avx2(
                               subpel_y_qn, conv_params);
 #endif
 }
+
+void av1_convolve_2d_sr_horiz_avx2(const uint8_t *src, int src_stride,
+                                   int16_t *im_buf, int w, int h,
+                                   const InterpFilterParams *filter_params_x,
+                                   const int subpel_x_qn,
+                                   ConvolveParams *conv_params) {
+  assert(filter_params_x->taps == SUBPEL_TAPS);
+  assert(conv_params->round_0 > 0);
+  const int bd = 8;
+  const int im_h = h + SUBPEL_TAPS - 1;
+  const int im_stride = 8;
+  int i;
+
+  const __m256i round_const_h =
+      _mm256_set1_epi16(((1 << (conv_params->round_0 - 1)) >> 1) +
+                        (1 << (bd + FILTER_BITS - 2)));
+  const __m128i round_shift_h = _mm_cvtsi32_si128(conv_params->round_0 - 1);
+
+  __m256i filt[4], coeffs_h[4];
+  prepare_coeffs_lowbd(filter_params_x, subpel_x_qn, coeffs_h);
+
+  filt[0] = _mm256_load_si256((__m256i const *)filt1_global_avx2);
+  filt[1] = _mm256_load_si256((__m256i const *)filt2_global_avx2);
+  filt[2] = _mm256_load_si256((__m256i const *)filt3_global_avx2);
+  filt[3] = _mm256_load_si256((__m256i const *)filt4_global_avx2);
+
+  const int fo_vert = SUBPEL_TAPS / 2 - 1;
+  const int fo_horiz = SUBPEL_TAPS / 2 - 1;
+  const uint8_t *const src_ptr = src - fo_vert * src_stride - fo_horiz;
+
+  for (int j = 0; j < w; j += 8) {
+    int16_t *const im_block =
+        im_buf + (j >> 3) * CONVOLVE_2D_SR_IM_STRIPE_SIZE(h);
+    CONVOLVE_SR_HORIZONTAL_FILTER_8TAP
+  }
+}
+
+void av1_convolve_2d_sr_vert_avx2(const int16_t *im_buf, uint8_t *dst,
+                                  int dst_stride, int w, int h,
+                                  const InterpFilterParams *filter_params_y,
+                                  const int subpel_y_qn,
+                                  ConvolveParams *conv_params) {
+  assert(filter_params_y->taps == SUBPEL_TAPS);
+  const int bd = 8;
+  const int im_stride = 8;
+  int i;
+  const int bits =
+      FILTER_BITS * 2 - conv_params->round_0 - conv_params->round_1;
+  const int offset_bits = bd + 2 * FILTER_BITS - conv_params->round_0;
+
+  const __m256i sum_round_v = _mm256_set1_epi32(
+      (1 << offset_bits) + ((1 << conv_params->round_1) >> 1));
+  const __m128i sum_shift_v = _mm_cvtsi32_si128(conv_params->round_1);
+
+  const __m256i round_const_v = _mm256_set1_epi32(
+      ((1 << bits) >> 1) - (1 << (offset_bits - conv_params->round_1)) -
+      ((1 << (offset_bits - conv_params->round_1)) >> 1));
+  const __m128i round_shift_v = _mm_cvtsi32_si128(bits);
+
+  __m256i coeffs_v[4];
+  prepare_coeffs(filter_params_y, subpel_y_qn, coeffs_v);
+
+  for (int j = 0; j < w; j += 8) {
+    const int16_t *const im_block =
+        im_buf + (j >> 3) * CONVOLVE_2D_SR_IM_STRIPE_SIZE(h);
+    CONVOLVE_SR_VERTICAL_FILTER_8TAP
+  }
+}
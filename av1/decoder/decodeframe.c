@@ -5157,7 +5157,12 @@ static inline void superres_post_decode(AV1Decoder *pbi) {
   if (!av1_superres_scaled(cm)) return;
   assert(!cm->features.all_lossless);
 
-  av1_superres_upscale(cm, pool, 0);
+  if (pbi->num_workers > 1) {
+    av1_superres_upscale_mt(cm, pool, pbi->tile_workers, pbi->num_workers,
+                            &pbi->superres_sync);
+  } else {
+    av1_superres_upscale(cm, pool, 0);
+  }
 }
 
 uint32_t av1_decode_frame_headers_and_setup(AV1Decoder *pbi,
@@ -240,6 +240,7 @@ typedef struct AV1Decoder {
   AV1LrStruct lr_ctxt;
   AV1CdefSync cdef_sync;
   AV1CdefWorkerData *cdef_worker;
+  AV1SuperresSync superres_sync;
   AVxWorker *tile_workers;
   int num_workers;
   DecWorkerData *thread_data;
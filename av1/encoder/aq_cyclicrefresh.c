@@ -85,6 +85,16 @@ static int compute_deltaq(const AV1_COMP *cpi, int q, double rate_factor) {
   return deltaq;
 }
 
+// Returns the sum of the products of bits and block counts divided by
+// num4x4bl, rounded to nearest. The segment weights are kept as block counts
+// so the average is exact and does not depend on how the compiler evaluates
+// floating point.
+static int weighted_segment_bits(int64_t weighted_bits, int num4x4bl) {
+  return (int)(weighted_bits >= 0
+                   ? (weighted_bits + num4x4bl / 2) / num4x4bl
+                   : -((-weighted_bits + num4x4bl / 2) / num4x4bl));
+}
+
 int av1_cyclic_refresh_estimate_bits_at_q(const AV1_COMP *cpi,
                                           double correction_factor) {
   const AV1_COMMON *const cm = &cpi->common;
@@ -94,59 +104,55 @@ int av1_cyclic_refresh_estimate_bits_at_q(const AV1_COMP *cpi,
   const int num4x4bl = mbs << 4;
   // Weight for non-base segments: use actual number of blocks refreshed in
   // previous/just encoded frame. Note number of blocks here is in 4x4 units.
-  double weight_segment1 = (double)cr->actual_num_seg1_blocks / num4x4bl;
-  double weight_segment2 = (double)cr->actual_num_seg2_blocks / num4x4bl;
+  int64_t num_seg1_blocks = cr->actual_num_seg1_blocks;
+  int64_t num_seg2_blocks = cr->actual_num_seg2_blocks;
   if (cpi->rc.rtc_external_ratectrl) {
-    weight_segment1 = (double)(cr->percent_refresh * cm->mi_params.mi_rows *
-                               cm->mi_params.mi_cols / 100) /
-                      num4x4bl;
-    weight_segment2 = 0;
+    num_seg1_blocks = cr->percent_refresh * cm->mi_params.mi_rows *
+                      cm->mi_params.mi_cols / 100;
+    num_seg2_blocks = 0;
   }
   // Take segment weighted average for estimated bits.
-  const int estimated_bits = (int)round(
-      (1.0 - weight_segment1 - weight_segment2) *
+  const int64_t weighted_bits =
+      (num4x4bl - num_seg1_blocks - num_seg2_blocks) *
           av1_estimate_bits_at_q(cpi, base_qindex, correction_factor) +
-      weight_segment1 *
+      num_seg1_blocks *
           av1_estimate_bits_at_q(cpi, base_qindex + cr->qindex_delta[1],
                                  correction_factor) +
-      weight_segment2 *
+      num_seg2_blocks *
           av1_estimate_bits_at_q(cpi, base_qindex + cr->qindex_delta[2],
-                                 correction_factor));
-  return estimated_bits;
+                                 correction_factor);
+  return weighted_segment_bits(weighted_bits, num4x4bl);
 }
 
 int av1_cyclic_refresh_rc_bits_per_mb(const AV1_COMP *cpi, int i,
                                       double correction_factor) {
   const AV1_COMMON *const cm = &cpi->common;
   CYCLIC_REFRESH *const cr = cpi->cyclic_refresh;
-  int bits_per_mb;
   int num4x4bl = cm->mi_params.MBs << 4;
   // Weight for segment prior to encoding: take the average of the target
   // number for the frame to be encoded and the actual from the previous frame.
-  double weight_segment =
-      (double)((cr->target_num_seg_blocks + cr->actual_num_seg1_blocks +
-                cr->actual_num_seg2_blocks) >>
-               1) /
-      num4x4bl;
+  int64_t num_seg_blocks = (cr->target_num_seg_blocks +
+                            cr->actual_num_seg1_blocks +
+                            cr->actual_num_seg2_blocks) >>
+                           1;
   if (cpi->rc.rtc_external_ratectrl) {
-    weight_segment = (double)((cr->target_num_seg_blocks +
-                               cr->percent_refresh * cm->mi_params.mi_rows *
-                                   cm->mi_params.mi_cols / 100) >>
-                              1) /
-                     num4x4bl;
+    num_seg_blocks = (cr->target_num_seg_blocks +
+                      cr->percent_refresh * cm->mi_params.mi_rows *
+                          cm->mi_params.mi_cols / 100) >>
+                     1;
   }
   // Compute delta-q corresponding to qindex i.
   int deltaq = compute_deltaq(cpi, i, cr->rate_ratio_qdelta);
   const int accurate_estimate = cpi->sf.hl_sf.accurate_bit_estimate;
   // Take segment weighted average for bits per mb.
-  bits_per_mb = (int)round(
-      (1.0 - weight_segment) *
+  const int64_t weighted_bits =
+      (num4x4bl - num_seg_blocks) *
           av1_rc_bits_per_mb(cpi, cm->current_frame.frame_type, i,
                              correction_factor, accurate_estimate) +
-      weight_segment * av1_rc_bits_per_mb(cpi, cm->current_frame.frame_type,
+      num_seg_blocks * av1_rc_bits_per_mb(cpi, cm->current_frame.frame_type,
                                           i + deltaq, correction_factor,
-                                          accurate_estimate));
-  return bits_per_mb;
+                                          accurate_estimate);
+  return weighted_segment_bits(weighted_bits, num4x4bl);
 }
 
 void av1_cyclic_reset_segment_skip(const AV1_COMP *cpi, MACROBLOCK *const x,
@@ -594,15 +600,17 @@ void av1_cyclic_refresh_setup(AV1_COMP *const cpi) {
     return;
   } else {
     cr->counter_encode_maxq_scene_change++;
-    const double q = av1_convert_qindex_to_q(cm->quant_params.base_qindex,
-                                             cm->seq_params->bit_depth);
+    // The real Q value of av1_convert_qindex_to_q() is the ac quantizer
+    // divided by 4, 16 or 64 for 8, 10 or 12 bit, so q * q is computed from
+    // the quantizer with a shift.
+    const int64_t ac_q = av1_ac_quant_QTX(cm->quant_params.base_qindex, 0,
+                                          cm->seq_params->bit_depth);
+    const int q_sq_shift = 4 + 2 * (cm->seq_params->bit_depth - AOM_BITS_8);
     // Set rate threshold to some multiple (set to 2 for now) of the target
     // rate (target is given by sb64_target_rate and scaled by 256).
     cr->thresh_rate_sb = ((int64_t)(rc->sb64_target_rate) << 8) << 2;
     // Distortion threshold, quadratic in Q, scale factor to be adjusted.
-    // q will not exceed 457, so (q * q) is within 32bit; see:
-    // av1_convert_qindex_to_q(), av1_ac_quant(), ac_qlookup*[].
-    cr->thresh_dist_sb = ((int64_t)(q * q)) << 2;
+    cr->thresh_dist_sb = ((ac_q * ac_q) >> q_sq_shift) << 2;
     // For low-resoln or lower speeds, the rate/dist thresholds need to be
     // tuned/updated.
     if (cpi->oxcf.speed <= 7 || (cm->width * cm->height < 640 * 360)) {
@@ -10,6 +10,7 @@
  */
 
 #include <math.h>
+#include <stdlib.h>
 
 #include "config/aom_dsp_rtcd.h"
 
@@ -240,6 +241,29 @@ void av1_quantize_lp_c(const int16_t *coeff_ptr, intptr_t n_coeffs,
   *eob_ptr = eob + 1;
 }
 
+// Same as av1_quantize_lp(), and also returns the squared error between
+// coeff_ptr and dqcoeff_ptr (as av1_block_error_lp()) and the sum of absolute
+// values of qcoeff_ptr (as aom_satd_lp()).
+int64_t av1_quantize_lp_dist_c(const int16_t *coeff_ptr, intptr_t n_coeffs,
+                               const int16_t *round_ptr,
+                               const int16_t *quant_ptr, int16_t *qcoeff_ptr,
+                               int16_t *dqcoeff_ptr, const int16_t *dequant_ptr,
+                               uint16_t *eob_ptr, const int16_t *scan,
+                               const int16_t *iscan, int *qcoeff_abs_sum) {
+  av1_quantize_lp_c(coeff_ptr, n_coeffs, round_ptr, quant_ptr, qcoeff_ptr,
+                    dqcoeff_ptr, dequant_ptr, eob_ptr, scan, iscan);
+
+  int64_t error = 0;
+  int abs_sum = 0;
+  for (int i = 0; i < n_coeffs; i++) {
+    const int diff = coeff_ptr[i] - dqcoeff_ptr[i];
+    error += diff * diff;
+    abs_sum += abs(qcoeff_ptr[i]);
+  }
+  *qcoeff_abs_sum = abs_sum;
+  return error;
+}
+
 void av1_quantize_fp_32x32_c(const tran_low_t *coeff_ptr, intptr_t n_coeffs,
                              const int16_t *zbin_ptr, const int16_t *round_ptr,
                              const int16_t *quant_ptr,
@@ -37,6 +37,10 @@ extern "C" {
 #define MIN_TPL_BSIZE_1D 16
 //! Maximum number of tpl block in a super block
 #define MAX_TPL_BLK_IN_SB (MAX_SB_SIZE / MIN_TPL_BSIZE_1D)
+//! Log2 of the linear dimension of a superblock motion field unit
+#define SB_MV_FIELD_UNIT_LOG2 4
+//! Maximum number of motion field units along one side of a super block
+#define MAX_SB_MV_FIELD_UNITS (MAX_SB_SIZE >> SB_MV_FIELD_UNIT_LOG2)
 //! Number of txfm hash records kept for the partition block.
 #define RD_RECORD_BUFFER_LEN 8
 
@@ -71,6 +75,18 @@ typedef struct _mode_search_stat_nonrd {
 #endif  // COLLECT_NONRD_PICK_MODE_STAT
 /*!\endcond */
 
+/*!\cond */
+// State of the superblock motion field of one reference frame.
+enum {
+  // The motion field is not used for this superblock.
+  SB_MV_FIELD_UNAVAILABLE = 0,
+  // The motion field may be used, but has not been computed yet.
+  SB_MV_FIELD_PENDING,
+  // The motion field has been computed.
+  SB_MV_FIELD_VALID,
+} UENUM1BYTE(SB_MV_FIELD_STATE);
+/*!\endcond */
+
 /*! \brief Superblock level encoder info
  *
  * SuperblockEnc stores superblock level information used by the encoder for
@@ -101,6 +117,36 @@ typedef struct {
   //! TPL's stride for the arrays in this struct.
   int tpl_stride;
   /**@}*/
+
+  /*****************************************************************************
+   * \name Motion Field
+   *
+   * Coarse motion field of the superblock, computed on demand for each
+   * reference on the downsampled image pyramids and shared by the motion
+   * searches of all the block sizes of the partition search.
+   ****************************************************************************/
+  /**@{*/
+  //! State of the motion field of each reference.
+  SB_MV_FIELD_STATE mv_field_state[INTER_REFS_PER_FRAME];
+  //! Full-pel motion vector of each 16x16 unit, in raster order.
+  FULLPEL_MV mv_field[INTER_REFS_PER_FRAME]
+                     [MAX_SB_MV_FIELD_UNITS * MAX_SB_MV_FIELD_UNITS];
+  /**@}*/
+
+  /*****************************************************************************
+   * \name Transform RD Model
+   *
+   * Running sums used to calibrate the Hadamard based RD estimate of uniform
+   * transform sizes against the exact RD cost, indexed by transform size.
+   ****************************************************************************/
+  /**@{*/
+  //! Sum of the exact RD costs of the calibration samples.
+  int64_t txfm_rd_exact_sum[TX_SIZES_ALL];
+  //! Sum of the estimated RD costs of the calibration samples.
+  int64_t txfm_rd_est_sum[TX_SIZES_ALL];
+  //! Number of calibration samples.
+  int txfm_rd_samples[TX_SIZES_ALL];
+  /**@}*/
 } SuperBlockEnc;
 
 /*! \brief Stores the best performing modes.
@@ -376,6 +422,58 @@ typedef struct {
   uint8_t *tmp_best_mask_buf;
 } CompoundTypeRdBuffers;
 
+/*! \brief Caches horizontally filtered luma predictions during the
+ * interpolation filter search.
+ *
+ * The first pass of a 2D subpel prediction only depends on the x filter, so
+ * it is computed once per x filter and reused for all y filters. For sizes
+ * and alignment refer to alloc_interp_pred_cache().
+ */
+typedef struct {
+  //! Intermediate prediction for each switchable x filter.
+  int16_t *im_block[SWITCHABLE_FILTERS];
+  //! Bit i is set if im_block[i] is valid for the block being searched.
+  int valid_mask;
+} InterpPredCache;
+
+/*! \brief Number of tiles held by SubpelPlaneCache. Must be a power of 2. */
+#define SUBPEL_PLANE_CACHE_TILES 1024
+/*! \brief Log2 of the width and height of a SubpelPlaneCache tile. */
+#define SUBPEL_PLANE_CACHE_TILE_LOG2 4
+
+/*! \brief Identifies the content of one SubpelPlaneCache tile. */
+typedef struct {
+  //! Top-left pixel of the reference frame the tile was interpolated from,
+  //! NULL if the tile is empty.
+  const uint8_t *ref_origin;
+  //! Tile row, in units of tiles relative to ref_origin.
+  int16_t row;
+  //! Tile column, in units of tiles relative to ref_origin.
+  int16_t col;
+  //! Subpel phase and interpolation filter used to fill the tile.
+  int16_t phase;
+} SubpelPlaneTileTag;
+
+/*! \brief Caches upsampled luma reference tiles for the subpel motion search.
+ *
+ * The subpel search interpolates the same half and quarter pel reference
+ * positions again for every candidate mv, reference mv and block size tried by
+ * the partition search of a superblock. This cache keeps 16x16 tiles of those
+ * interpolated planes so that they are only computed once per superblock.
+ * Tiles are direct mapped and all of them are dropped at the start of each
+ * superblock. For sizes refer to alloc_subpel_plane_cache().
+ */
+typedef struct {
+  //! Interpolated tiles, stored contiguously.
+  uint8_t *tiles;
+  //! One tag per tile.
+  SubpelPlaneTileTag *tags;
+  //! Nonzero while a superblock is encoded and the cache may be used.
+  int active;
+  //! Distance in pixels that tiles may extend beyond the reference frames.
+  int margin;
+} SubpelPlaneCache;
+
 /*! \brief Holds some parameters related to partitioning schemes in AV1.
  */
 // TODO(chiyotsai@google.com): Consolidate this with SIMPLE_MOTION_DATA_TREE
@@ -939,6 +1037,10 @@ typedef struct macroblock {
   PALETTE_BUFFER *palette_buffer;
   //! Buffer used for compound_type_rd().
   CompoundTypeRdBuffers comp_rd_buffer;
+  //! Horizontal-pass cache used by av1_interpolation_filter_search().
+  InterpPredCache interp_pred_cache;
+  //! Upsampled reference cache used by the subpel motion search.
+  SubpelPlaneCache subpel_plane_cache;
   //! Buffer to store convolution during averaging process in compound mode.
   CONV_BUF_TYPE *tmp_conv_dst;
 
@@ -1072,6 +1174,27 @@ typedef struct macroblock {
    */
   int force_zeromv_skip_for_blk;
 
+  /*!\brief Flag to code the superblock as a GLOBALMV skip block, for rd path.
+   *
+   * Set from cpi->static_sb_map when the superblock is static content.
+   */
+  int static_sb_skip;
+
+  /*!\brief Flag to search the superblock with low effort.
+   *
+   * Set when the whole superblock is in low effort region of interest
+   * segments. Such superblocks use coarse partitions.
+   */
+  int roi_low_effort_sb;
+
+  /*!\brief Number of pixels searched in the current superblock.
+   *
+   * Counts the coefficients transformed by the transform type search of the
+   * rd path, or the pixels covered by mode search of the nonrd path. Used as
+   * a deterministic measure of encode cost for tile size balancing.
+   */
+  uint32_t sb_search_pels;
+
   /*! \brief Previous segment id for which qmatrices were updated.
    * This is used to bypass setting of qmatrices if no change in qindex.
    */
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2024, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include <string.h>
+
+#include "av1/encoder/checkpoint.h"
+
+// Checkpoints are only supported for the second pass of a two-pass encode,
+// where the first pass statistics of the whole clip are available up front and
+// the state that depends on past frames is small.
+static int checkpoint_supported(const AV1_PRIMARY *ppi) {
+#if CONFIG_REALTIME_ONLY
+  (void)ppi;
+  return 0;
+#else
+  const AV1_COMP *const cpi = ppi->cpi;
+  return is_stat_consumption_stage(cpi) && !ppi->lap_enabled &&
+         ppi->num_fp_contexts == 1 && !ppi->use_svc &&
+         !cpi->oxcf.kf_cfg.fwd_kf_enabled &&
+         !cpi->oxcf.kf_cfg.enable_sframe && ppi->twopass.stats_buf_ctx &&
+         ppi->twopass.stats_buf_ctx->total_left_stats;
+#endif  // CONFIG_REALTIME_ONLY
+}
+
+static int get_num_stats(const AV1_PRIMARY *ppi) {
+#if CONFIG_REALTIME_ONLY
+  (void)ppi;
+  return 0;
+#else
+  return ppi->twopass.firstpass_info.stats_buf_size;
+#endif  // CONFIG_REALTIME_ONLY
+}
+
+aom_codec_err_t av1_save_checkpoint(const AV1_PRIMARY *ppi,
+                                    AV1Checkpoint *checkpoint) {
+  if (!checkpoint_supported(ppi)) return AOM_CODEC_INCAPABLE;
+#if CONFIG_REALTIME_ONLY
+  (void)checkpoint;
+  return AOM_CODEC_INCAPABLE;
+#else
+  const AV1_COMP *const cpi = ppi->cpi;
+  const AV1_COMMON *const cm = &cpi->common;
+  // The next frame to be coded must start a key frame group, after the last
+  // GF group of the previous one has been coded completely.
+  if (cm->current_frame.frame_number == 0 || cpi->rc.frames_to_key != 0 ||
+      cpi->gf_frame_index < ppi->gf_group.size) {
+    return AOM_CODEC_ERROR;
+  }
+
+  const TWO_PASS *const twopass = &ppi->twopass;
+  const FIRSTPASS_INFO *const fp_info = &twopass->firstpass_info;
+  const STATS_BUFFER_CTX *const stats_buf_ctx = twopass->stats_buf_ctx;
+  memset(checkpoint, 0, sizeof(*checkpoint));
+  checkpoint->magic = AV1_CHECKPOINT_MAGIC;
+  checkpoint->version = AV1_CHECKPOINT_VERSION;
+  checkpoint->size = (uint32_t)sizeof(*checkpoint);
+  checkpoint->width = cpi->oxcf.frm_dim_cfg.width;
+  checkpoint->height = cpi->oxcf.frm_dim_cfg.height;
+  checkpoint->num_stats = get_num_stats(ppi);
+
+  checkpoint->p_rc = ppi->p_rc;
+  checkpoint->gf_state = ppi->gf_state;
+  checkpoint->mv_stats = ppi->mv_stats;
+  checkpoint->frame_probs = ppi->frame_probs;
+  memcpy(checkpoint->valid_gm_model_found, ppi->valid_gm_model_found,
+         sizeof(checkpoint->valid_gm_model_found));
+  checkpoint->frames_left = ppi->frames_left;
+  checkpoint->ts_start_last_show_frame = ppi->ts_start_last_show_frame;
+  checkpoint->ts_end_last_show_frame = ppi->ts_end_last_show_frame;
+
+  checkpoint->section_intra_rating = twopass->section_intra_rating;
+  checkpoint->bits_left = twopass->bits_left;
+  checkpoint->modified_error_min = twopass->modified_error_min;
+  checkpoint->modified_error_max = twopass->modified_error_max;
+  checkpoint->modified_error_left = twopass->modified_error_left;
+  checkpoint->kf_group_bits = twopass->kf_group_bits;
+  checkpoint->kf_group_error_left = twopass->kf_group_error_left;
+  checkpoint->bpm_factor = twopass->bpm_factor;
+  checkpoint->rolling_arf_group_target_bits =
+      twopass->rolling_arf_group_target_bits;
+  checkpoint->rolling_arf_group_actual_bits =
+      twopass->rolling_arf_group_actual_bits;
+  checkpoint->sr_update_lag = twopass->sr_update_lag;
+  checkpoint->kf_zeromotion_pct = twopass->kf_zeromotion_pct;
+  checkpoint->last_kfgroup_zeromotion_pct =
+      twopass->last_kfgroup_zeromotion_pct;
+  checkpoint->extend_minq = twopass->extend_minq;
+  checkpoint->extend_maxq = twopass->extend_maxq;
+  checkpoint->fp_info_start_index = fp_info->start_index;
+  checkpoint->fp_info_stats_count = fp_info->stats_count;
+  checkpoint->fp_info_cur_index = fp_info->cur_index;
+  checkpoint->fp_info_future_stats_count = fp_info->future_stats_count;
+  checkpoint->fp_info_past_stats_count = fp_info->past_stats_count;
+  checkpoint->fp_info_total_stats = fp_info->total_stats;
+  checkpoint->total_left_stats = *stats_buf_ctx->total_left_stats;
+
+  checkpoint->rc = cpi->rc;
+  checkpoint->time_stamps = cpi->time_stamps;
+  checkpoint->framerate = cpi->framerate;
+  checkpoint->new_framerate = cpi->new_framerate;
+  checkpoint->stats_in_offset =
+      (int)(cpi->twopass_frame.stats_in - stats_buf_ctx->stats_in_start);
+  checkpoint->this_frame_offset =
+      cpi->twopass_frame.this_frame
+          ? (int)(cpi->twopass_frame.this_frame - stats_buf_ctx->stats_in_start)
+          : -1;
+  checkpoint->mb_av_energy = cpi->twopass_frame.mb_av_energy;
+  checkpoint->fr_content_type = cpi->twopass_frame.fr_content_type;
+  checkpoint->frame_avg_haar_energy = cpi->twopass_frame.frame_avg_haar_energy;
+  checkpoint->frame_number = cm->current_frame.frame_number;
+  checkpoint->frame_index_set = cpi->frame_index_set;
+  checkpoint->film_grain_random_seed = cm->film_grain_params.random_seed;
+  return AOM_CODEC_OK;
+#endif  // CONFIG_REALTIME_ONLY
+}
+
+aom_codec_err_t av1_restore_checkpoint(AV1_PRIMARY *ppi,
+                                       const AV1Checkpoint *checkpoint) {
+  if (!checkpoint_supported(ppi)) return AOM_CODEC_INCAPABLE;
+#if CONFIG_REALTIME_ONLY
+  (void)checkpoint;
+  return AOM_CODEC_INCAPABLE;
+#else
+  AV1_COMP *const cpi = ppi->cpi;
+  AV1_COMMON *const cm = &cpi->common;
+  if (checkpoint->magic != AV1_CHECKPOINT_MAGIC ||
+      checkpoint->version != AV1_CHECKPOINT_VERSION ||
+      checkpoint->size != sizeof(*checkpoint) ||
+      checkpoint->width != cpi->oxcf.frm_dim_cfg.width ||
+      checkpoint->height != cpi->oxcf.frm_dim_cfg.height ||
+      checkpoint->num_stats != get_num_stats(ppi)) {
+    return AOM_CODEC_INVALID_PARAM;
+  }
+  if (cm->current_frame.frame_number != 0 ||
+      av1_lookahead_depth(ppi->lookahead, ENCODE_STAGE) != 0) {
+    return AOM_CODEC_ERROR;
+  }
+  const int num_stats = checkpoint->num_stats;
+  if (checkpoint->stats_in_offset < 0 ||
+      checkpoint->stats_in_offset > num_stats ||
+      checkpoint->this_frame_offset >= num_stats) {
+    return AOM_CODEC_INVALID_PARAM;
+  }
+
+  TWO_PASS *const twopass = &ppi->twopass;
+  FIRSTPASS_INFO *const fp_info = &twopass->firstpass_info;
+  STATS_BUFFER_CTX *const stats_buf_ctx = twopass->stats_buf_ctx;
+  ppi->p_rc = checkpoint->p_rc;
+  ppi->gf_state = checkpoint->gf_state;
+  ppi->mv_stats = checkpoint->mv_stats;
+  ppi->frame_probs = checkpoint->frame_probs;
+  memcpy(ppi->valid_gm_model_found, checkpoint->valid_gm_model_found,
+         sizeof(ppi->valid_gm_model_found));
+  ppi->frames_left = checkpoint->frames_left;
+  ppi->ts_start_last_show_frame = checkpoint->ts_start_last_show_frame;
+  ppi->ts_end_last_show_frame = checkpoint->ts_end_last_show_frame;
+
+  twopass->section_intra_rating = checkpoint->section_intra_rating;
+  twopass->bits_left = checkpoint->bits_left;
+  twopass->modified_error_min = checkpoint->modified_error_min;
+  twopass->modified_error_max = checkpoint->modified_error_max;
+  twopass->modified_error_left = checkpoint->modified_error_left;
+  twopass->kf_group_bits = checkpoint->kf_group_bits;
+  twopass->kf_group_error_left = checkpoint->kf_group_error_left;
+  twopass->bpm_factor = checkpoint->bpm_factor;
+  twopass->rolling_arf_group_target_bits =
+      checkpoint->rolling_arf_group_target_bits;
+  twopass->rolling_arf_group_actual_bits =
+      checkpoint->rolling_arf_group_actual_bits;
+  twopass->sr_update_lag = checkpoint->sr_update_lag;
+  twopass->kf_zeromotion_pct = checkpoint->kf_zeromotion_pct;
+  twopass->last_kfgroup_zeromotion_pct =
+      checkpoint->last_kfgroup_zeromotion_pct;
+  twopass->extend_minq = checkpoint->extend_minq;
+  twopass->extend_maxq = checkpoint->extend_maxq;
+  fp_info->start_index = checkpoint->fp_info_start_index;
+  fp_info->stats_count = checkpoint->fp_info_stats_count;
+  fp_info->cur_index = checkpoint->fp_info_cur_index;
+  fp_info->future_stats_count = checkpoint->fp_info_future_stats_count;
+  fp_info->past_stats_count = checkpoint->fp_info_past_stats_count;
+  fp_info->total_stats = checkpoint->fp_info_total_stats;
+  *stats_buf_ctx->total_left_stats = checkpoint->total_left_stats;
+
+  cpi->rc = checkpoint->rc;
+  cpi->time_stamps = checkpoint->time_stamps;
+  cpi->framerate = checkpoint->framerate;
+  cpi->new_framerate = checkpoint->new_framerate;
+  cpi->twopass_frame.stats_in =
+      stats_buf_ctx->stats_in_start + checkpoint->stats_in_offset;
+  cpi->twopass_frame.this_frame =
+      checkpoint->this_frame_offset >= 0
+          ? stats_buf_ctx->stats_in_start + checkpoint->this_frame_offset
+          : NULL;
+  cpi->twopass_frame.mb_av_energy = checkpoint->mb_av_energy;
+  cpi->twopass_frame.fr_content_type = checkpoint->fr_content_type;
+  cpi->twopass_frame.frame_avg_haar_energy = checkpoint->frame_avg_haar_energy;
+  cm->current_frame.frame_number = checkpoint->frame_number;
+  cpi->frame_index_set = checkpoint->frame_index_set;
+  cm->film_grain_params.random_seed = checkpoint->film_grain_random_seed;
+  return AOM_CODEC_OK;
+#endif  // CONFIG_REALTIME_ONLY
+}
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2024, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#ifndef AOM_AV1_ENCODER_CHECKPOINT_H_
+#define AOM_AV1_ENCODER_CHECKPOINT_H_
+
+#include "av1/encoder/encoder.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!\cond */
+
+#define AV1_CHECKPOINT_MAGIC 0x4b435641  // "AVCK"
+#define AV1_CHECKPOINT_VERSION 1
+
+// Encoder state needed to continue a two-pass encode from a key frame
+// boundary. Everything else is either derived from the configuration or
+// rebuilt when the key frame group starts: the key frame refreshes every
+// reference buffer and resets the frame contexts, and the GF group, TPL and
+// temporal filter buffers are computed from the lookahead.
+//
+// The checkpoint is a plain copy of encoder structures, so it can only be
+// restored by the same library build with the same configuration and first
+// pass statistics.
+typedef struct {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t size;
+  int width;
+  int height;
+  int num_stats;
+
+  // AV1_PRIMARY.
+  PRIMARY_RATE_CONTROL p_rc;
+  GF_STATE gf_state;
+  MV_STATS mv_stats;
+  FrameProbInfo frame_probs;
+  int valid_gm_model_found[FRAME_UPDATE_TYPES];
+  int frames_left;
+  int64_t ts_start_last_show_frame;
+  int64_t ts_end_last_show_frame;
+
+  // TWO_PASS, without the pointers into the statistics buffer.
+  unsigned int section_intra_rating;
+  int64_t bits_left;
+  double modified_error_min;
+  double modified_error_max;
+  double modified_error_left;
+  int64_t kf_group_bits;
+  double kf_group_error_left;
+  double bpm_factor;
+  int rolling_arf_group_target_bits;
+  int rolling_arf_group_actual_bits;
+  int sr_update_lag;
+  int kf_zeromotion_pct;
+  int last_kfgroup_zeromotion_pct;
+  int extend_minq;
+  int extend_maxq;
+  int fp_info_start_index;
+  int fp_info_stats_count;
+  int fp_info_cur_index;
+  int fp_info_future_stats_count;
+  int fp_info_past_stats_count;
+  FIRSTPASS_STATS fp_info_total_stats;
+  FIRSTPASS_STATS total_left_stats;
+
+  // AV1_COMP.
+  RATE_CONTROL rc;
+  TimeStamps time_stamps;
+  double framerate;
+  double new_framerate;
+  int stats_in_offset;
+  int this_frame_offset;
+  double mb_av_energy;
+  FRAME_CONTENT_TYPE fr_content_type;
+  double frame_avg_haar_energy;
+  unsigned int frame_number;
+  FRAME_INDEX_SET frame_index_set;
+  uint16_t film_grain_random_seed;
+} AV1Checkpoint;
+
+/*!\endcond */
+
+/*!\brief Saves the encoder state at a key frame boundary
+ *
+ * \ingroup high_level_algo
+ * \param[in]   ppi          Top level primary encoder structure
+ * \param[out]  checkpoint   Checkpoint to fill
+ *
+ * \return AOM_CODEC_OK on success. AOM_CODEC_INCAPABLE if the configuration
+ * does not support checkpoints, and AOM_CODEC_ERROR if the next frame to be
+ * coded does not start a key frame group.
+ */
+aom_codec_err_t av1_save_checkpoint(const AV1_PRIMARY *ppi,
+                                    AV1Checkpoint *checkpoint);
+
+/*!\brief Restores the encoder state from a checkpoint
+ *
+ * \ingroup high_level_algo
+ * \param[in]   ppi          Top level primary encoder structure
+ * \param[in]   checkpoint   Checkpoint saved by av1_save_checkpoint()
+ *
+ * \return AOM_CODEC_OK on success. The encoder must not have received any
+ * frame yet, and must use the configuration and first pass statistics the
+ * checkpoint was saved with.
+ */
+aom_codec_err_t av1_restore_checkpoint(AV1_PRIMARY *ppi,
+                                       const AV1Checkpoint *checkpoint);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif  // AOM_AV1_ENCODER_CHECKPOINT_H_
@@ -9,6 +9,7 @@
  * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
  */
 
+#include "aom_dsp/blend.h"
 #include "av1/common/pred_common.h"
 #include "av1/encoder/compound_type.h"
 #include "av1/encoder/encoder_alloc.h"
@@ -199,7 +200,6 @@ static int64_t pick_wedge(const AV1_COMP *const cpi, const MACROBLOCK *const x,
   int8_t wedge_index;
   int8_t wedge_sign;
   const int8_t wedge_types = get_wedge_types_lookup(bsize);
-  const uint8_t *mask;
   uint64_t sse;
   const int hbd = is_cur_buf_hbd(xd);
   const int bd_round = hbd ? (xd->bd - 8) * 2 : 0;
@@ -224,14 +224,25 @@ static int64_t pick_wedge(const AV1_COMP *const cpi, const MACROBLOCK *const x,
 
   av1_wedge_compute_delta_squares(ds, residual0, residual1, N);
 
+  // Evaluate the sign and then the SSE of every wedge in a single pass over
+  // the residuals each, rather than re-reading them once per wedge.
+  const uint8_t *masks[MAX_WEDGE_TYPES];
+  int8_t wedge_signs[MAX_WEDGE_TYPES];
+  uint64_t wedge_sse[MAX_WEDGE_TYPES];
+  for (wedge_index = 0; wedge_index < wedge_types; ++wedge_index)
+    masks[wedge_index] = av1_get_contiguous_soft_mask(wedge_index, 0, bsize);
+  av1_wedge_sign_from_residuals_multi(ds, masks, wedge_types, N, sign_limit,
+                                      wedge_signs);
   for (wedge_index = 0; wedge_index < wedge_types; ++wedge_index) {
-    mask = av1_get_contiguous_soft_mask(wedge_index, 0, bsize);
-
-    wedge_sign = av1_wedge_sign_from_residuals(ds, mask, N, sign_limit);
+    masks[wedge_index] = av1_get_contiguous_soft_mask(
+        wedge_index, wedge_signs[wedge_index], bsize);
+  }
+  av1_wedge_sse_from_residuals_multi(residual1, diff10, masks, wedge_types, N,
+                                     wedge_sse);
 
-    mask = av1_get_contiguous_soft_mask(wedge_index, wedge_sign, bsize);
-    sse = av1_wedge_sse_from_residuals(residual1, diff10, mask, N);
-    sse = ROUND_POWER_OF_TWO(sse, bd_round);
+  for (wedge_index = 0; wedge_index < wedge_types; ++wedge_index) {
+    wedge_sign = wedge_signs[wedge_index];
+    sse = ROUND_POWER_OF_TWO(wedge_sse[wedge_index], bd_round);
 
     model_rd_sse_fn[MODELRD_TYPE_MASKED_COMPOUND](cpi, x, bsize, 0, sse, N,
                                                   &rate, &dist);
@@ -275,14 +286,19 @@ static int64_t pick_wedge_fixed_sign(
   int64_t rd, best_rd = INT64_MAX;
   int8_t wedge_index;
   const int8_t wedge_types = get_wedge_types_lookup(bsize);
-  const uint8_t *mask;
   uint64_t sse;
   const int hbd = is_cur_buf_hbd(xd);
   const int bd_round = hbd ? (xd->bd - 8) * 2 : 0;
+  const uint8_t *masks[MAX_WEDGE_TYPES] = { NULL };
+  uint64_t wedge_sse[MAX_WEDGE_TYPES];
+  for (wedge_index = 0; wedge_index < wedge_types; ++wedge_index) {
+    masks[wedge_index] =
+        av1_get_contiguous_soft_mask(wedge_index, wedge_sign, bsize);
+  }
+  av1_wedge_sse_from_residuals_multi(residual1, diff10, masks, wedge_types, N,
+                                     wedge_sse);
   for (wedge_index = 0; wedge_index < wedge_types; ++wedge_index) {
-    mask = av1_get_contiguous_soft_mask(wedge_index, wedge_sign, bsize);
-    sse = av1_wedge_sse_from_residuals(residual1, diff10, mask, N);
-    sse = ROUND_POWER_OF_TWO(sse, bd_round);
+    sse = ROUND_POWER_OF_TWO(wedge_sse[wedge_index], bd_round);
 
     model_rd_sse_fn[MODELRD_TYPE_MASKED_COMPOUND](cpi, x, bsize, 0, sse, N,
                                                   &rate, &dist);
@@ -350,28 +366,30 @@ static int64_t pick_interinter_seg(const AV1_COMP *const cpi,
   const int hbd = is_cur_buf_hbd(xd);
   const int bd_round = hbd ? (xd->bd - 8) * 2 : 0;
   DECLARE_ALIGNED(16, uint8_t, seg_mask[2 * MAX_SB_SQUARE]);
-  uint8_t *tmp_mask[2] = { xd->seg_mask, seg_mask };
-  // try each mask type and its inverse
-  for (cur_mask_type = 0; cur_mask_type < DIFFWTD_MASK_TYPES; cur_mask_type++) {
-    // build mask and inverse
+  const uint8_t *tmp_mask[DIFFWTD_MASK_TYPES] = { xd->seg_mask, seg_mask };
+  uint64_t mask_sse[DIFFWTD_MASK_TYPES];
+  // Build the DIFFWTD_38 mask once and derive its inverse from it.
 #if CONFIG_AV1_HIGHBITDEPTH
-    if (hbd)
-      av1_build_compound_diffwtd_mask_highbd(
-          tmp_mask[cur_mask_type], cur_mask_type, CONVERT_TO_BYTEPTR(p0), bw,
-          CONVERT_TO_BYTEPTR(p1), bw, bh, bw, xd->bd);
-    else
-      av1_build_compound_diffwtd_mask(tmp_mask[cur_mask_type], cur_mask_type,
-                                      p0, bw, p1, bw, bh, bw);
+  if (hbd)
+    av1_build_compound_diffwtd_mask_highbd(
+        xd->seg_mask, DIFFWTD_38, CONVERT_TO_BYTEPTR(p0), bw,
+        CONVERT_TO_BYTEPTR(p1), bw, bh, bw, xd->bd);
+  else
+    av1_build_compound_diffwtd_mask(xd->seg_mask, DIFFWTD_38, p0, bw, p1, bw,
+                                    bh, bw);
 #else
-    (void)hbd;
-    av1_build_compound_diffwtd_mask(tmp_mask[cur_mask_type], cur_mask_type, p0,
-                                    bw, p1, bw, bh, bw);
+  (void)hbd;
+  av1_build_compound_diffwtd_mask(xd->seg_mask, DIFFWTD_38, p0, bw, p1, bw, bh,
+                                  bw);
 #endif  // CONFIG_AV1_HIGHBITDEPTH
+  for (int i = 0; i < N; i++)
+    seg_mask[i] = AOM_BLEND_A64_MAX_ALPHA - xd->seg_mask[i];
 
-    // compute rd for mask
-    uint64_t sse = av1_wedge_sse_from_residuals(residual1, diff10,
-                                                tmp_mask[cur_mask_type], N);
-    sse = ROUND_POWER_OF_TWO(sse, bd_round);
+  // compute sse for the mask and its inverse
+  av1_wedge_sse_from_residuals_multi(residual1, diff10, tmp_mask,
+                                     DIFFWTD_MASK_TYPES, N, mask_sse);
+  for (cur_mask_type = 0; cur_mask_type < DIFFWTD_MASK_TYPES; cur_mask_type++) {
+    const uint64_t sse = ROUND_POWER_OF_TWO(mask_sse[cur_mask_type], bd_round);
 
     model_rd_sse_fn[MODELRD_TYPE_MASKED_COMPOUND](cpi, x, bsize, 0, sse, N,
                                                   &rate, &dist);
@@ -385,7 +403,7 @@ static int64_t pick_interinter_seg(const AV1_COMP *const cpi,
   }
   mbmi->interinter_comp.mask_type = best_mask_type;
   if (best_mask_type == DIFFWTD_38_INV) {
-    memcpy(xd->seg_mask, seg_mask, N * 2);
+    memcpy(xd->seg_mask, seg_mask, N);
   }
   return best_rd;
 }
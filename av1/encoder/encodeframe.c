@@ -536,6 +536,7 @@ static inline void encode_nonrd_sb(AV1_COMP *cpi, ThreadData *td,
 #endif
   // Set the partition
   if (sf->part_sf.partition_search_type == FIXED_PARTITION || seg_skip ||
+      x->roi_low_effort_sb ||
       (sf->rt_sf.use_fast_fixed_part && x->sb_force_fixed_part == 1 &&
        (!frame_is_intra_only(cm) &&
         (!cpi->ppi->use_svc ||
@@ -543,7 +544,8 @@ static inline void encode_nonrd_sb(AV1_COMP *cpi, ThreadData *td,
     // set a fixed-size partition
     av1_set_offsets(cpi, tile_info, x, mi_row, mi_col, sb_size);
     BLOCK_SIZE bsize_select = sf->part_sf.fixed_partition_size;
-    if (sf->rt_sf.use_fast_fixed_part &&
+    if (x->roi_low_effort_sb) bsize_select = BLOCK_32X32;
+    if ((sf->rt_sf.use_fast_fixed_part || x->roi_low_effort_sb) &&
         x->content_state_sb.source_sad_nonrd < kLowSad) {
       bsize_select = cm->seq_params->sb_size;
     }
@@ -634,6 +636,9 @@ static inline void init_encode_rd_sb(AV1_COMP *cpi, ThreadData *td,
   x->reuse_inter_pred = false;
   x->txfm_search_params.mode_eval_type = DEFAULT_EVAL;
   reset_mb_rd_record(x->txfm_search_info.mb_rd_record);
+  av1_zero(x->sb_enc.txfm_rd_exact_sum);
+  av1_zero(x->sb_enc.txfm_rd_est_sum);
+  av1_zero(x->sb_enc.txfm_rd_samples);
   av1_zero(x->picked_ref_frames_mask);
   av1_invalid_rd_stats(rd_cost);
 }
@@ -707,6 +712,9 @@ static void sb_qp_sweep_init_quantizers(AV1_COMP *cpi, ThreadData *td,
   x->reuse_inter_pred = false;
   x->txfm_search_params.mode_eval_type = DEFAULT_EVAL;
   reset_mb_rd_record(x->txfm_search_info.mb_rd_record);
+  av1_zero(x->sb_enc.txfm_rd_exact_sum);
+  av1_zero(x->sb_enc.txfm_rd_est_sum);
+  av1_zero(x->sb_enc.txfm_rd_samples);
   av1_zero(x->picked_ref_frames_mask);
   av1_invalid_rd_stats(rd_cost);
 }
@@ -794,7 +802,11 @@ static inline void encode_rd_sb(AV1_COMP *cpi, ThreadData *td,
   if (sf->part_sf.partition_search_type == VAR_BASED_PARTITION) {
     // partition search starting from a variance-based partition
     av1_set_offsets(cpi, tile_info, x, mi_row, mi_col, sb_size);
-    av1_choose_var_based_partitioning(cpi, tile_info, td, x, mi_row, mi_col);
+    if (x->roi_low_effort_sb)
+      av1_set_fixed_partitioning(cpi, tile_info, mi, mi_row, mi_col,
+                                 AOMMIN(sb_size, BLOCK_32X32));
+    else
+      av1_choose_var_based_partitioning(cpi, tile_info, td, x, mi_row, mi_col);
 
 #if CONFIG_COLLECT_COMPONENT_TIMING
     start_timing(cpi, rd_use_partition_time);
@@ -833,6 +845,12 @@ static inline void encode_rd_sb(AV1_COMP *cpi, ThreadData *td,
     SuperBlockEnc *sb_enc = &x->sb_enc;
     // No stats for overlay frames. Exclude key frame.
     av1_get_tpl_stats_sb(cpi, sb_size, mi_row, mi_col, sb_enc);
+    // The motion field of each reference is computed on first use.
+    memset(sb_enc->mv_field_state,
+           cpi->sf.mv_sf.use_sb_mv_field && cpi->alloc_pyramid
+               ? SB_MV_FIELD_PENDING
+               : SB_MV_FIELD_UNAVAILABLE,
+           sizeof(sb_enc->mv_field_state));
 
     // Reset the tree for simple motion search data
     av1_reset_simple_motion_tree_partition(sms_root, sb_size);
@@ -946,6 +964,7 @@ static inline void encode_rd_sb(AV1_COMP *cpi, ThreadData *td,
 
     // Reset to 0 so that it wouldn't be used elsewhere mistakenly.
     sb_enc->tpl_data_count = 0;
+    av1_zero(sb_enc->mv_field_state);
 #if CONFIG_COLLECT_COMPONENT_TIMING
     end_timing(cpi, rd_pick_partition_time);
 #endif
@@ -1116,6 +1135,24 @@ static inline void grade_source_content_sb(AV1_COMP *cpi, MACROBLOCK *const x,
     av1_source_content_sb(cpi, x, tile_data, mi_row, mi_col);
 }
 
+// Returns 1 if the whole superblock is in low effort region of interest
+// segments.
+static inline int is_roi_low_effort_sb(const AV1_COMP *cpi, int mi_row,
+                                       int mi_col) {
+  const RoiMap *const roi = &cpi->roi;
+  if (!roi->applied) return 0;
+  const int mib_size = cpi->common.seq_params->mib_size;
+  const int mi_row_end = AOMMIN(mi_row + mib_size, roi->mi_rows);
+  const int mi_col_end = AOMMIN(mi_col + mib_size, roi->mi_cols);
+  for (int r = mi_row; r < mi_row_end; ++r) {
+    const unsigned char *const map = &roi->map[r * roi->mi_cols];
+    for (int c = mi_col; c < mi_col_end; ++c) {
+      if (!roi->low_effort[map[c]]) return 0;
+    }
+  }
+  return 1;
+}
+
 /*!\brief Encode a superblock row by breaking it into superblocks
  *
  * \ingroup partition_search
@@ -1140,6 +1177,8 @@ static inline void encode_sb_row(AV1_COMP *cpi, ThreadData *td,
   const int mib_size = cm->seq_params->mib_size;
   const int mib_size_log2 = cm->seq_params->mib_size_log2;
   const int sb_row = (mi_row - tile_info->mi_row_start) >> mib_size_log2;
+  const int sb_cols_in_frame =
+      CEIL_POWER_OF_TWO(cm->mi_params.mi_cols, mib_size_log2);
   const int use_nonrd_mode = cpi->sf.rt_sf.use_nonrd_pick_mode;
 
 #if CONFIG_COLLECT_COMPONENT_TIMING
@@ -1247,12 +1286,35 @@ static inline void encode_sb_row(AV1_COMP *cpi, ThreadData *td,
     // fast mode search strategy for coding blocks
     if (!seg_skip) grade_source_content_sb(cpi, x, tile_data, mi_row, mi_col);
 
+    // Static superblocks are coded as a GLOBALMV skip block without search.
+    x->static_sb_skip =
+        !seg_skip && !use_nonrd_mode && cpi->sf.part_sf.static_sb_skip &&
+        cpi->static_sb_map[(mi_row >> mib_size_log2) * sb_cols_in_frame +
+                           (mi_col >> mib_size_log2)];
+
+    x->roi_low_effort_sb = is_roi_low_effort_sb(cpi, mi_row, mi_col);
+
+    av1_subpel_plane_cache_start_sb(&x->subpel_plane_cache,
+                                    cpi->oxcf.border_in_pixels);
+    x->sb_search_pels = 0;
+
     // encode the superblock
     if (use_nonrd_mode) {
       encode_nonrd_sb(cpi, td, tile_data, tp, mi_row, mi_col, seg_skip);
     } else {
-      encode_rd_sb(cpi, td, tile_data, tp, mi_row, mi_col, seg_skip);
+      encode_rd_sb(cpi, td, tile_data, tp, mi_row, mi_col,
+                   seg_skip || x->static_sb_skip);
     }
+    x->static_sb_skip = 0;
+    if (cpi->sb_search_cost_cols == sb_cols_in_frame) {
+      // Running average over frames, for tile size balancing.
+      uint32_t *const sb_cost =
+          &cpi->sb_search_cost[(mi_row >> mib_size_log2) * sb_cols_in_frame +
+                               (mi_col >> mib_size_log2)];
+      *sb_cost = (*sb_cost + x->sb_search_pels + 1) >> 1;
+    }
+
+    av1_subpel_plane_cache_end_sb(&x->subpel_plane_cache);
 
     // Update the top-right context in row_mt coding
     if (update_cdf && (tile_info->mi_row_end > (mi_row + mib_size))) {
@@ -2021,6 +2083,7 @@ static inline void encode_frame_internal(AV1_COMP *cpi) {
   av1_initialize_rd_consts(cpi);
   av1_set_sad_per_bit(cpi, &x->sadperbit, quant_params->base_qindex);
   populate_thresh_to_force_zeromv_skip(cpi);
+  av1_compute_static_sb_map(cpi);
 
   enc_row_mt->sync_read_ptr = av1_row_mt_sync_read_dummy;
   enc_row_mt->sync_write_ptr = av1_row_mt_sync_write_dummy;
@@ -2342,6 +2405,8 @@ void av1_encode_frame(AV1_COMP *cpi) {
     }
   }
 
+  av1_balance_tile_sizes(cpi);
+
   av1_setup_frame_buf_refs(cm);
   enforce_max_ref_frames(cpi, &cpi->ref_frame_flags,
                          cm->cur_frame->ref_display_order_hint,
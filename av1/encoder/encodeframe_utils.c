@@ -292,7 +292,7 @@ void av1_update_state(const AV1_COMP *const cpi, ThreadData *td,
     for (x_idx = 0; x_idx < cols; x_idx++) xd->mi[x_idx + y * mis] = mi_addr;
   }
 
-  if (cpi->oxcf.q_cfg.aq_mode)
+  if (cpi->oxcf.q_cfg.aq_mode || cpi->roi.applied)
     av1_init_plane_quantizers(cpi, x, mi_addr->segment_id, 0);
 
   if (dry_run) return;
@@ -1426,6 +1426,112 @@ void av1_source_content_sb(AV1_COMP *cpi, MACROBLOCK *x, TileDataEnc *tile_data,
 }
 
 // Memset the mbmis at the current superblock to 0
+// Returns 1 if every 16x16 luma block of the superblock, and the co-located
+// chroma blocks, are unchanged from the previous source and match the
+// LAST_FRAME reconstruction closely enough that a skip block is the expected RD
+// choice.
+static int is_static_sb(const AV1_COMP *cpi, const YV12_BUFFER_CONFIG *ref,
+                        int mi_row, int mi_col, unsigned int qstep) {
+  const AV1_COMMON *const cm = &cpi->common;
+  const YV12_BUFFER_CONFIG *const src = cpi->source;
+  const YV12_BUFFER_CONFIG *const last_src = cpi->last_source;
+  const int num_planes = av1_num_planes(cm);
+  const int sb_size = block_size_wide[cm->seq_params->sb_size];
+
+  for (int plane = 0; plane < num_planes; ++plane) {
+    const int is_uv = plane > 0;
+    const int ss_x = is_uv ? cm->seq_params->subsampling_x : 0;
+    const int ss_y = is_uv ? cm->seq_params->subsampling_y : 0;
+    const BLOCK_SIZE bsize = get_plane_block_size(BLOCK_16X16, ss_x, ss_y);
+    const aom_variance_fn_t vf = cpi->ppi->fn_ptr[bsize].vf;
+    const int bw = block_size_wide[bsize];
+    const int bh = block_size_high[bsize];
+    const int num_pels_log2 = num_pels_log2_lookup[bsize];
+    // The previous source may differ by rounding noise only. The
+    // reconstruction error must stay well below the quantization noise of a
+    // uniform quantizer (qstep^2 / 12) so that coding the residual would not
+    // pay off.
+    const unsigned int src_thresh = 1u << num_pels_log2;
+    const unsigned int ref_thresh =
+        (unsigned int)(((uint64_t)qstep * qstep << num_pels_log2) / 16);
+    const int src_stride = src->strides[is_uv];
+    const int last_stride = last_src->strides[is_uv];
+    const int ref_stride = ref->strides[is_uv];
+    const int x0 = (mi_col * MI_SIZE) >> ss_x;
+    const int y0 = (mi_row * MI_SIZE) >> ss_y;
+    const int w = sb_size >> ss_x;
+    const int h = sb_size >> ss_y;
+
+    for (int y = y0; y < y0 + h; y += bh) {
+      for (int x = x0; x < x0 + w; x += bw) {
+        const uint8_t *const src_buf = src->buffers[plane] + y * src_stride + x;
+        unsigned int sse;
+        vf(src_buf, src_stride,
+           last_src->buffers[plane] + y * last_stride + x, last_stride, &sse);
+        if (sse > src_thresh) return 0;
+        vf(src_buf, src_stride, ref->buffers[plane] + y * ref_stride + x,
+           ref_stride, &sse);
+        if (sse > ref_thresh) return 0;
+      }
+    }
+  }
+  return 1;
+}
+
+// Marks the superblocks of the current frame that are static with respect to
+// both the previous source frame and the LAST_FRAME reconstruction. The rd
+// path codes these as a single GLOBALMV skip block instead of searching them.
+void av1_compute_static_sb_map(AV1_COMP *cpi) {
+  AV1_COMMON *const cm = &cpi->common;
+  const CommonModeInfoParams *const mi_params = &cm->mi_params;
+  const int mib_size = cm->seq_params->mib_size;
+  const int mib_size_log2 = cm->seq_params->mib_size_log2;
+  const int sb_rows = CEIL_POWER_OF_TWO(mi_params->mi_rows, mib_size_log2);
+  const int sb_cols = CEIL_POWER_OF_TWO(mi_params->mi_cols, mib_size_log2);
+  const int map_size = sb_rows * sb_cols;
+
+  if (!cpi->sf.part_sf.static_sb_skip) return;
+
+  if (cpi->static_sb_map_alloc_size < map_size) {
+    aom_free(cpi->static_sb_map);
+    cpi->static_sb_map_alloc_size = 0;
+    CHECK_MEM_ERROR(cm, cpi->static_sb_map,
+                    aom_malloc(map_size * sizeof(*cpi->static_sb_map)));
+    cpi->static_sb_map_alloc_size = map_size;
+  }
+  memset(cpi->static_sb_map, 0, map_size * sizeof(*cpi->static_sb_map));
+
+  const YV12_BUFFER_CONFIG *const src = cpi->source;
+  const YV12_BUFFER_CONFIG *const last_src = cpi->last_source;
+  const YV12_BUFFER_CONFIG *const ref = get_ref_frame_yv12_buf(cm, LAST_FRAME);
+  if (frame_is_intra_only(cm) || cpi->sf.rt_sf.use_nonrd_pick_mode ||
+      !(cpi->ref_frame_flags & AOM_LAST_FLAG) || last_src == NULL ||
+      ref == NULL || cm->seg.enabled || cm->quant_params.base_qindex == 0 ||
+      cm->global_motion[LAST_FRAME].wmtype != IDENTITY ||
+      av1_is_scaled(get_ref_scale_factors_const(cm, LAST_FRAME)) ||
+      src->y_crop_width != cm->width || src->y_crop_height != cm->height ||
+      last_src->y_crop_width != cm->width ||
+      last_src->y_crop_height != cm->height)
+    return;
+
+  const int bit_depth = cm->seq_params->bit_depth;
+  const unsigned int qstep =
+      av1_ac_quant_QTX(cm->quant_params.base_qindex, 0, bit_depth) >>
+      (3 + bit_depth - 8);
+
+  // Superblocks crossing the frame boundary are left to the regular search.
+  for (int sb_row = 0; sb_row < sb_rows; ++sb_row) {
+    const int mi_row = sb_row << mib_size_log2;
+    if (mi_row + mib_size > mi_params->mi_rows) break;
+    for (int sb_col = 0; sb_col < sb_cols; ++sb_col) {
+      const int mi_col = sb_col << mib_size_log2;
+      if (mi_col + mib_size > mi_params->mi_cols) break;
+      cpi->static_sb_map[sb_row * sb_cols + sb_col] =
+          is_static_sb(cpi, ref, mi_row, mi_col, qstep);
+    }
+  }
+}
+
 void av1_reset_mbmi(CommonModeInfoParams *const mi_params, BLOCK_SIZE sb_size,
                     int mi_row, int mi_col) {
   // size of sb in unit of mi (BLOCK_4X4)
@@ -195,6 +195,42 @@ int av1_set_active_map(AV1_COMP *cpi, unsigned char *new_map_16x16, int rows,
   return -1;
 }
 
+int av1_set_roi_map(AV1_COMP *cpi, const aom_roi_map_t *roi) {
+  const CommonModeInfoParams *const mi_params = &cpi->common.mi_params;
+  const int mi_rows = mi_params->mi_rows;
+  const int mi_cols = mi_params->mi_cols;
+  RoiMap *const roi_map = &cpi->roi;
+  if (roi->roi_map == NULL) {
+    roi_map->enabled = 0;
+    return 0;
+  }
+  // The map has an entry for each 8x8 block.
+  if (roi->rows != (unsigned int)(mi_rows + 1) / 2 ||
+      roi->cols != (unsigned int)(mi_cols + 1) / 2)
+    return -1;
+  for (int i = 0; i < MAX_SEGMENTS; ++i) {
+    if (abs(roi->delta_q[i]) > MAXQ) return -1;
+  }
+  for (unsigned int i = 0; i < roi->rows * roi->cols; ++i) {
+    if (roi->roi_map[i] >= MAX_SEGMENTS) return -1;
+  }
+
+  for (int r = 0; r < mi_rows; ++r) {
+    for (int c = 0; c < mi_cols; ++c) {
+      roi_map->map[r * mi_cols + c] =
+          roi->roi_map[(r >> 1) * roi->cols + (c >> 1)];
+    }
+  }
+  for (int i = 0; i < MAX_SEGMENTS; ++i) {
+    roi_map->delta_q[i] = roi->delta_q[i];
+    roi_map->low_effort[i] = roi->low_effort[i] != 0;
+  }
+  roi_map->mi_rows = mi_rows;
+  roi_map->mi_cols = mi_cols;
+  roi_map->enabled = 1;
+  return 0;
+}
+
 int av1_get_active_map(AV1_COMP *cpi, unsigned char *new_map_16x16, int rows,
                        int cols) {
   const CommonModeInfoParams *const mi_params = &cpi->common.mi_params;
@@ -358,6 +394,172 @@ static void set_tile_info(AV1_COMMON *const cm,
   av1_calculate_tile_rows(seq_params, mi_params->mi_rows, tiles);
 }
 
+// Splits num_sbs superblock columns (or rows) into num_tiles tiles of at most
+// max_size_sb superblocks, such that no tile exceeds max_cost in any of the
+// num_groups tile rows (or columns) crossing it. cost[i * num_groups + g] is
+// the cost of the i-th superblock column in the g-th group. Tiles are grown
+// greedily, which finds a split whenever one exists. Returns 1 on success.
+static int split_tiles_by_cost(const uint64_t *cost, int num_sbs,
+                               int num_groups, int num_tiles, int max_size_sb,
+                               uint64_t max_cost, int *start_sb) {
+  int sb = 0;
+  for (int i = 0; i < num_tiles; ++i) {
+    const int last = i == num_tiles - 1;
+    const int max_end = last ? num_sbs
+                             : AOMMIN(sb + max_size_sb,
+                                      num_sbs - (num_tiles - 1 - i));
+    uint64_t tile_cost[AOMMAX(MAX_TILE_ROWS, MAX_TILE_COLS)] = { 0 };
+    start_sb[i] = sb;
+    for (; sb < max_end; ++sb) {
+      const uint64_t *const sb_cost = &cost[sb * num_groups];
+      int fits = 1;
+      for (int g = 0; g < num_groups; ++g)
+        fits &= tile_cost[g] + sb_cost[g] <= max_cost;
+      if (!fits) {
+        if (last || sb == start_sb[i]) return 0;
+        break;
+      }
+      for (int g = 0; g < num_groups; ++g) tile_cost[g] += sb_cost[g];
+    }
+  }
+  if (num_sbs - start_sb[num_tiles - 1] > max_size_sb) return 0;
+  start_sb[num_tiles] = num_sbs;
+  return 1;
+}
+
+// Chooses tile boundaries along one dimension that minimize the cost of the
+// most expensive tile, given the tile boundaries of the other dimension.
+// Returns the number of tiles, or 0 if no split satisfies the size limits.
+static int cost_based_tile_size_balancing(const uint64_t *cost, int num_sbs,
+                                          int num_groups, int num_tiles_lg,
+                                          int max_size_sb, int *start_sb) {
+  const int num_tiles = AOMMIN(1 << num_tiles_lg, num_sbs);
+  uint64_t hi = 0;
+  for (int i = 0; i < num_sbs * num_groups; ++i) hi += cost[i];
+  if (hi == 0 || !split_tiles_by_cost(cost, num_sbs, num_groups, num_tiles,
+                                      max_size_sb, hi, start_sb))
+    return 0;
+  // Binary search for the smallest feasible cost of the most expensive tile.
+  uint64_t lo = 0;
+  while (lo + 1 < hi) {
+    const uint64_t mid = lo + (hi - lo) / 2;
+    if (split_tiles_by_cost(cost, num_sbs, num_groups, num_tiles, max_size_sb,
+                            mid, start_sb))
+      hi = mid;
+    else
+      lo = mid;
+  }
+  split_tiles_by_cost(cost, num_sbs, num_groups, num_tiles, max_size_sb, hi,
+                      start_sb);
+  return num_tiles;
+}
+
+// Moves the tile boundaries of auto balanced tiles (negative tile width or
+// height in TileConfig) so that the most expensive tile of the current frame,
+// by the search cost of the previous frames, is as cheap as possible.
+// This shortens the critical path of tile based multi-threading. The number
+// of tiles is unchanged.
+void av1_balance_tile_sizes(AV1_COMP *cpi) {
+  AV1_COMMON *const cm = &cpi->common;
+  const TileConfig *const tile_cfg = &cpi->oxcf.tile_cfg;
+  const SequenceHeader *const seq_params = cm->seq_params;
+  const CommonModeInfoParams *const mi_params = &cm->mi_params;
+  CommonTileParams *const tiles = &cm->tiles;
+  const int auto_balance =
+      tile_cfg->tile_width_count > 0 && tile_cfg->tile_height_count > 0 &&
+      !tile_cfg->enable_large_scale_tile && !av1_superres_scaled(cm);
+  const int balance_cols = auto_balance && tile_cfg->tile_widths[0] < 0;
+  const int balance_rows = auto_balance && tile_cfg->tile_heights[0] < 0;
+  const int sb_cols =
+      CEIL_POWER_OF_TWO(mi_params->mi_cols, seq_params->mib_size_log2);
+  const int sb_rows =
+      CEIL_POWER_OF_TWO(mi_params->mi_rows, seq_params->mib_size_log2);
+  const int map_size = sb_rows * sb_cols;
+
+  if (!balance_cols && !balance_rows) {
+    cpi->sb_search_cost_rows = 0;
+    cpi->sb_search_cost_cols = 0;
+    return;
+  }
+
+  if (cpi->sb_search_cost_rows != sb_rows ||
+      cpi->sb_search_cost_cols != sb_cols) {
+    if (cpi->sb_search_cost_alloc_size < map_size) {
+      aom_free(cpi->sb_search_cost);
+      cpi->sb_search_cost_alloc_size = 0;
+      CHECK_MEM_ERROR(cm, cpi->sb_search_cost,
+                      aom_malloc(map_size * sizeof(*cpi->sb_search_cost)));
+      cpi->sb_search_cost_alloc_size = map_size;
+    }
+    // No costs yet. Keep the layout based on superblock counts and start
+    // collecting costs.
+    memset(cpi->sb_search_cost, 0, map_size * sizeof(*cpi->sb_search_cost));
+    cpi->sb_search_cost_rows = sb_rows;
+    cpi->sb_search_cost_cols = sb_cols;
+    return;
+  }
+
+  const CommonTileParams prev_tiles = *tiles;
+  const uint32_t *const sb_cost = cpi->sb_search_cost;
+  int start_sb[AOMMAX(MAX_TILE_COLS, MAX_TILE_ROWS) + 1];
+  uint64_t *cost;
+  CHECK_MEM_ERROR(cm, cost, aom_malloc(map_size * sizeof(*cost)));
+
+  if (balance_cols && tiles->cols > 1) {
+    // Cost of each superblock column within each tile row.
+    for (int col = 0; col < sb_cols; ++col) {
+      for (int tile_row = 0; tile_row < tiles->rows; ++tile_row) {
+        uint64_t sum = 0;
+        for (int row = tiles->row_start_sb[tile_row];
+             row < tiles->row_start_sb[tile_row + 1]; ++row)
+          sum += sb_cost[row * sb_cols + col];
+        cost[col * tiles->rows + tile_row] = sum;
+      }
+    }
+    if (cost_based_tile_size_balancing(cost, sb_cols, tiles->rows,
+                                       tile_cfg->tile_columns,
+                                       tiles->max_width_sb,
+                                       start_sb) == tiles->cols) {
+      memcpy(tiles->col_start_sb, start_sb,
+             (tiles->cols + 1) * sizeof(*start_sb));
+      av1_calculate_tile_cols(seq_params, mi_params->mi_rows,
+                              mi_params->mi_cols, tiles);
+    }
+  }
+
+  if (balance_rows && tiles->rows > 1) {
+    // Cost of each superblock row within each tile column.
+    for (int row = 0; row < sb_rows; ++row) {
+      for (int tile_col = 0; tile_col < tiles->cols; ++tile_col) {
+        uint64_t sum = 0;
+        for (int col = tiles->col_start_sb[tile_col];
+             col < tiles->col_start_sb[tile_col + 1]; ++col)
+          sum += sb_cost[row * sb_cols + col];
+        cost[row * tiles->cols + tile_col] = sum;
+      }
+    }
+    if (cost_based_tile_size_balancing(cost, sb_rows, tiles->cols,
+                                       tile_cfg->tile_rows,
+                                       tiles->max_height_sb,
+                                       start_sb) == tiles->rows) {
+      memcpy(tiles->row_start_sb, start_sb,
+             (tiles->rows + 1) * sizeof(*start_sb));
+      av1_calculate_tile_rows(seq_params, mi_params->mi_rows, tiles);
+    }
+  }
+  aom_free(cost);
+
+  // Wider tile columns lower the maximum tile height allowed by the tile area
+  // limit. Keep the previous layout if the tile rows no longer fit.
+  for (int i = 0; i < tiles->rows; ++i) {
+    if (tiles->row_start_sb[i + 1] - tiles->row_start_sb[i] >
+        tiles->max_height_sb) {
+      *tiles = prev_tiles;
+      break;
+    }
+  }
+}
+
 void av1_update_frame_size(AV1_COMP *cpi) {
   AV1_COMMON *const cm = &cpi->common;
   MACROBLOCKD *const xd = &cpi->td.mb.e_mbd;
@@ -877,13 +1079,18 @@ void av1_change_config(struct AV1_COMP *cpi, const AV1EncoderConfig *oxcf,
         aom_memalign(32, MAX_SB_SIZE * MAX_SB_SIZE * sizeof(*x->tmp_conv_dst)));
     x->e_mbd.tmp_conv_dst = x->tmp_conv_dst;
   }
-  // The buffers 'tmp_pred_bufs[]' and 'comp_rd_buffer' are used in inter frames
-  // to store intermediate inter mode prediction results and are not required
-  // for allintra encoding mode. Hence, the memory allocations for these buffers
-  // are avoided for allintra encoding mode.
+  // The buffers 'tmp_pred_bufs[]', 'comp_rd_buffer', 'interp_pred_cache' and
+  // 'subpel_plane_cache' are used in inter frames to store intermediate inter
+  // mode prediction results and are not required for allintra encoding mode.
+  // Hence, the memory allocations for these buffers are avoided for allintra
+  // encoding mode.
   if (cpi->oxcf.kf_cfg.key_freq_max != 0) {
     if (x->comp_rd_buffer.pred0 == NULL)
       alloc_compound_type_rd_buffers(cm->error, &x->comp_rd_buffer);
+    if (x->interp_pred_cache.im_block[0] == NULL)
+      alloc_interp_pred_cache(cm->error, &x->interp_pred_cache);
+    if (x->subpel_plane_cache.tiles == NULL)
+      alloc_subpel_plane_cache(cm->error, &x->subpel_plane_cache);
 
     for (int i = 0; i < 2; ++i) {
       if (x->tmp_pred_bufs[i] == NULL) {
@@ -2676,6 +2883,7 @@ static int encode_without_recode(AV1_COMP *cpi) {
     }
   }
   av1_apply_active_map(cpi);
+  av1_apply_roi_map(cpi);
   if (q_cfg->aq_mode == CYCLIC_REFRESH_AQ) av1_cyclic_refresh_setup(cpi);
   if (cm->seg.enabled) {
     if (!cm->seg.update_data && cm->prev_frame) {
@@ -2994,6 +3202,7 @@ static int encode_with_recode_loop(AV1_COMP *cpi, size_t *size, uint8_t *dest,
     } else if (q_cfg->aq_mode == COMPLEXITY_AQ) {
       av1_setup_in_frame_q_adj(cpi);
     }
+    av1_apply_roi_map(cpi);
 
     if (cm->seg.enabled) {
       if (!cm->seg.update_data && cm->prev_frame) {
@@ -4139,6 +4348,24 @@ int av1_receive_raw_frame(AV1_COMP *cpi, aom_enc_frame_flags_t frame_flags,
   setup_denoiser_buffer(cpi);
 #endif
 
+  // A frame of a different size is scaled straight into the lookahead buffer,
+  // and the rest of the preprocessing then works on the smaller frame.
+  YV12_BUFFER_CONFIG *scaled = NULL;
+  if (cpi->oxcf.input_cfg.scale_input &&
+      (sd->y_crop_width != cpi->oxcf.frm_dim_cfg.width ||
+       sd->y_crop_height != cpi->oxcf.frm_dim_cfg.height)) {
+    scaled = av1_lookahead_push_scaled(
+        cpi->ppi->lookahead, sd, cpi->oxcf.frm_dim_cfg.width,
+        cpi->oxcf.frm_dim_cfg.height, seq_params->bit_depth, time_stamp,
+        end_time, use_highbitdepth, cpi->alloc_pyramid, frame_flags);
+    if (!scaled) {
+      aom_set_error(cm->error, AOM_CODEC_ERROR,
+                    "av1_lookahead_push_scaled() failed");
+      return -1;
+    }
+    sd = scaled;
+  }
+
 #if CONFIG_DENOISE
   // even if denoise_noise_level is > 0, we don't need need to denoise on pass
   // 1 of 2 if enable_dnl_denoising is disabled since the 2nd pass will be
@@ -4167,11 +4394,14 @@ int av1_receive_raw_frame(AV1_COMP *cpi, aom_enc_frame_flags_t frame_flags,
     if (apply_denoise_2d(cpi, sd, cpi->oxcf.noise_block_size,
                          cpi->oxcf.noise_level, time_stamp, end_time) < 0)
       res = -1;
+    // The denoiser wrote over the scaled frame, so its border is stale.
+    if (scaled) aom_extend_frame_borders(scaled, av1_num_planes(cm));
 #endif  // !CONFIG_REALTIME_ONLY
   }
 #endif  //  CONFIG_DENOISE
 
-  if (av1_lookahead_push(cpi->ppi->lookahead, sd, time_stamp, end_time,
+  if (!scaled &&
+      av1_lookahead_push(cpi->ppi->lookahead, sd, time_stamp, end_time,
                          use_highbitdepth, cpi->alloc_pyramid, frame_flags)) {
     aom_set_error(cm->error, AOM_CODEC_ERROR, "av1_lookahead_push() failed");
     res = -1;
@@ -4411,6 +4641,14 @@ void print_internal_stats(AV1_PRIMARY *ppi) {
       SNPRINT2(results, " %7.2f", rate_err);
       SNPRINT2(results, " %7.2f", fabs(rate_err));
 
+      const uint64_t tf_ref_blocks =
+          ppi->tf_ref_blocks_filtered + ppi->tf_ref_blocks_skipped;
+      if (tf_ref_blocks > 0) {
+        SNPRINT(headings, "\tTfRefUse");
+        SNPRINT2(results, " %7.2f",
+                 100.0 * ppi->tf_ref_blocks_filtered / tf_ref_blocks);
+      }
+
       SNPRINT(headings, "\tAPsnr611");
       SNPRINT2(results, " %7.3f",
                (6 * ppi->psnr[0].stat[STAT_Y] + ppi->psnr[0].stat[STAT_U] +
@@ -4677,6 +4915,10 @@ void av1_post_encode_updates(AV1_COMP *const cpi,
   }
 
   if (!is_stat_generation_stage(cpi)) {
+    const int decoder_threads =
+        AOMMAX((int)cpi->oxcf.tune_cfg.target_decoder_threads, 1);
+    ppi->predicted_decode_time_us = (int)lround(
+        av1_estimate_frame_decode_time(cpi, decoder_threads) * 1000000);
 #if !CONFIG_REALTIME_ONLY
     if (!has_no_stats_stage(cpi)) av1_twopass_postencode_update(cpi);
 #endif
@@ -772,6 +772,9 @@ typedef struct {
   int film_grain_test_vector;
   // Indicates the in-block distortion metric to use.
   aom_dist_metric dist_metric;
+  // Indicates the number of decoder threads to tune the encoding for, or 0 to
+  // not tune for decode speed.
+  unsigned int target_decoder_threads;
 } TuneCfg;
 
 typedef struct {
@@ -785,6 +788,9 @@ typedef struct {
   unsigned int chroma_subsampling_x;
   // Indicates the chrome subsampling y value.
   unsigned int chroma_subsampling_y;
+  // Indicates if input frames of a different size are scaled to the frame
+  // size as they enter the lookahead.
+  bool scale_input;
 } InputCfg;
 
 typedef struct {
@@ -1469,6 +1475,8 @@ typedef struct ThreadData {
   OBMCBuffer obmc_buffer;
   PALETTE_BUFFER *palette_buffer;
   CompoundTypeRdBuffers comp_rd_buffer;
+  InterpPredCache interp_pred_cache;
+  SubpelPlaneCache subpel_plane_cache;
   CONV_BUF_TYPE *tmp_conv_dst;
   uint64_t abs_sum_level;
   uint8_t *tmp_pred_bufs[2];
@@ -1852,6 +1860,18 @@ typedef struct ActiveMap {
   unsigned char *map;
 } ActiveMap;
 
+typedef struct RoiMap {
+  int enabled;
+  // Set while the map is coded as the segmentation of the current frame.
+  int applied;
+  // Segment id of each 4x4 block, for a frame of mi_rows x mi_cols.
+  unsigned char *map;
+  int mi_rows;
+  int mi_cols;
+  int delta_q[MAX_SEGMENTS];
+  int low_effort[MAX_SEGMENTS];
+} RoiMap;
+
 /*!\endcond */
 
 /*!
@@ -2631,6 +2651,12 @@ typedef struct AV1_PRIMARY {
    */
   int64_t ts_end_last_show_frame;
 
+  /*!
+   * Predicted decode time of the last coded frame, in microseconds, on
+   * oxcf.tune_cfg.target_decoder_threads decoder threads (at least one).
+   */
+  int predicted_decode_time_us;
+
   /*!
    * Number of frame level contexts(cpis)
    */
@@ -2820,6 +2846,8 @@ typedef struct AV1_PRIMARY {
 
   double total_inconsistency;
   double worst_consistency;
+  uint64_t tf_ref_blocks_filtered;
+  uint64_t tf_ref_blocks_skipped;
   Ssimv *ssim_vars;
   Metrics metrics;
   /*!\endcond */
@@ -3128,6 +3156,12 @@ typedef struct AV1_COMP {
    */
   ActiveMap active_map;
 
+  /*!
+   * Region of interest map, coded as segments with their own quantizer
+   * deltas and search effort.
+   */
+  RoiMap roi;
+
   /*!
    * The frame processing order within a GOP.
    */
@@ -3613,6 +3647,39 @@ typedef struct AV1_COMP {
    */
   uint64_t *src_sad_blk_64x64;
 
+  /*!
+   * Per-superblock flags marking static content that is coded as a GLOBALMV
+   * skip block without search. Computed by av1_compute_static_sb_map().
+   */
+  uint8_t *static_sb_map;
+
+  /*!
+   * Allocated memory size for |static_sb_map|.
+   */
+  int static_sb_map_alloc_size;
+
+  /*!
+   * Running average of the search cost of each superblock over the encoded
+   * frames, measured in pixels searched (see MACROBLOCK::sb_search_pels). Used
+   * to balance tile sizes by encode cost, see av1_balance_tile_sizes().
+   */
+  uint32_t *sb_search_cost;
+
+  /*!
+   * Allocated memory size for |sb_search_cost|.
+   */
+  int sb_search_cost_alloc_size;
+
+  /*!
+   * Superblock rows and columns of the frame |sb_search_cost| was collected
+   * for. Zero if no costs are available.
+   */
+  int sb_search_cost_rows;
+  /*!
+   * See |sb_search_cost_rows|.
+   */
+  int sb_search_cost_cols;
+
   /*!
    * SSE between the current frame and the reconstructed last frame
    * It is only used for CBR mode.
@@ -3868,6 +3935,8 @@ int av1_set_active_map(AV1_COMP *cpi, unsigned char *map, int rows, int cols);
 
 int av1_get_active_map(AV1_COMP *cpi, unsigned char *map, int rows, int cols);
 
+int av1_set_roi_map(AV1_COMP *cpi, const aom_roi_map_t *roi);
+
 int av1_set_internal_size(AV1EncoderConfig *const oxcf,
                           ResizePendingParams *resize_pending_params,
                           AOM_SCALING_MODE horiz_mode,
@@ -3900,6 +3969,8 @@ void av1_set_screen_content_options(struct AV1_COMP *cpi,
 
 void av1_update_frame_size(AV1_COMP *cpi);
 
+void av1_balance_tile_sizes(AV1_COMP *cpi);
+
 typedef struct {
   int pyr_level;
   int disp_order;
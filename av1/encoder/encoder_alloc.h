@@ -121,6 +121,13 @@ static inline void realloc_segmentation_maps(AV1_COMP *cpi) {
   aom_free(cpi->active_map.map);
   CHECK_MEM_ERROR(cm, cpi->active_map.map,
                   aom_calloc(mi_params->mi_rows * mi_params->mi_cols, 1));
+
+  // Create a map of region of interest segments. A map set for the previous
+  // frame size no longer applies.
+  aom_free(cpi->roi.map);
+  CHECK_MEM_ERROR(cm, cpi->roi.map,
+                  aom_calloc(mi_params->mi_rows * mi_params->mi_cols, 1));
+  cpi->roi.enabled = 0;
 }
 
 static inline void alloc_obmc_buffers(OBMCBuffer *obmc_buffer,
@@ -182,6 +189,42 @@ static inline void release_compound_type_rd_buffers(
   av1_zero(*bufs);  // Set all pointers to NULL for safety.
 }
 
+static inline void alloc_interp_pred_cache(
+    struct aom_internal_error_info *error, InterpPredCache *const cache) {
+  int16_t *buf;
+  AOM_CHECK_MEM_ERROR(
+      error, buf,
+      (int16_t *)aom_memalign(32, SWITCHABLE_FILTERS *
+                                      CONVOLVE_2D_SR_IM_BLOCK_SIZE *
+                                      sizeof(*buf)));
+  for (int i = 0; i < SWITCHABLE_FILTERS; ++i)
+    cache->im_block[i] = buf + i * CONVOLVE_2D_SR_IM_BLOCK_SIZE;
+  cache->valid_mask = 0;
+}
+
+static inline void release_interp_pred_cache(InterpPredCache *const cache) {
+  aom_free(cache->im_block[0]);
+  av1_zero(*cache);  // Set all pointers to NULL for safety.
+}
+
+static inline void alloc_subpel_plane_cache(
+    struct aom_internal_error_info *error, SubpelPlaneCache *const cache) {
+  const int tile_size = 1 << (2 * SUBPEL_PLANE_CACHE_TILE_LOG2);
+  AOM_CHECK_MEM_ERROR(
+      error, cache->tiles,
+      (uint8_t *)aom_memalign(32, SUBPEL_PLANE_CACHE_TILES * tile_size));
+  AOM_CHECK_MEM_ERROR(error, cache->tags,
+                      (SubpelPlaneTileTag *)aom_calloc(
+                          SUBPEL_PLANE_CACHE_TILES, sizeof(*cache->tags)));
+  cache->active = 0;
+}
+
+static inline void release_subpel_plane_cache(SubpelPlaneCache *const cache) {
+  aom_free(cache->tiles);
+  aom_free(cache->tags);
+  av1_zero(*cache);  // Set all pointers to NULL for safety.
+}
+
 static inline void dealloc_compressor_data(AV1_COMP *cpi) {
   AV1_COMMON *const cm = &cpi->common;
   TokenInfo *token_info = &cpi->token_info;
@@ -205,6 +248,9 @@ static inline void dealloc_compressor_data(AV1_COMP *cpi) {
   aom_free(cpi->active_map.map);
   cpi->active_map.map = NULL;
 
+  aom_free(cpi->roi.map);
+  cpi->roi.map = NULL;
+
   aom_free(cpi->ssim_rdmult_scaling_factors);
   cpi->ssim_rdmult_scaling_factors = NULL;
 
@@ -333,6 +379,8 @@ static inline void dealloc_compressor_data(AV1_COMP *cpi) {
 
   aom_free(cpi->td.mb.palette_buffer);
   release_compound_type_rd_buffers(&cpi->td.mb.comp_rd_buffer);
+  release_interp_pred_cache(&cpi->td.mb.interp_pred_cache);
+  release_subpel_plane_cache(&cpi->td.mb.subpel_plane_cache);
   aom_free(cpi->td.mb.tmp_conv_dst);
   for (int j = 0; j < 2; ++j) {
     aom_free(cpi->td.mb.tmp_pred_bufs[j]);
@@ -363,6 +411,16 @@ static inline void dealloc_compressor_data(AV1_COMP *cpi) {
   aom_free(cpi->src_sad_blk_64x64);
   cpi->src_sad_blk_64x64 = NULL;
 
+  aom_free(cpi->static_sb_map);
+  cpi->static_sb_map = NULL;
+  cpi->static_sb_map_alloc_size = 0;
+
+  aom_free(cpi->sb_search_cost);
+  cpi->sb_search_cost = NULL;
+  cpi->sb_search_cost_alloc_size = 0;
+  cpi->sb_search_cost_rows = 0;
+  cpi->sb_search_cost_cols = 0;
+
   aom_free(cpi->mb_weber_stats);
   cpi->mb_weber_stats = NULL;
 
@@ -473,6 +531,8 @@ static inline void free_thread_data(AV1_PRIMARY *ppi) {
     aom_free(td->palette_buffer);
     aom_free(td->tmp_conv_dst);
     release_compound_type_rd_buffers(&td->comp_rd_buffer);
+    release_interp_pred_cache(&td->interp_pred_cache);
+    release_subpel_plane_cache(&td->subpel_plane_cache);
     for (int j = 0; j < 2; ++j) {
       aom_free(td->tmp_pred_bufs[j]);
     }
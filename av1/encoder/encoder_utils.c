@@ -470,6 +470,36 @@ void av1_apply_active_map(AV1_COMP *cpi) {
   }
 }
 
+void av1_apply_roi_map(AV1_COMP *cpi) {
+  AV1_COMMON *const cm = &cpi->common;
+  struct segmentation *const seg = &cm->seg;
+  RoiMap *const roi = &cpi->roi;
+  const int use_roi = roi->enabled && cpi->oxcf.q_cfg.aq_mode == NO_AQ &&
+                      !cpi->active_map.enabled &&
+                      roi->mi_rows == cm->mi_params.mi_rows &&
+                      roi->mi_cols == cm->mi_params.mi_cols;
+  if (!use_roi) {
+    if (roi->applied) {
+      av1_clearall_segfeatures(seg);
+      av1_disable_segmentation(seg);
+      roi->applied = 0;
+    }
+    return;
+  }
+
+  memcpy(cpi->enc_seg.map, roi->map,
+         sizeof(*roi->map) * roi->mi_rows * roi->mi_cols);
+  av1_enable_segmentation(seg);
+  av1_clearall_segfeatures(seg);
+  for (int i = 0; i < MAX_SEGMENTS; ++i) {
+    if (roi->delta_q[i]) {
+      av1_enable_segfeature(seg, i, SEG_LVL_ALT_Q);
+      av1_set_segdata(seg, i, SEG_LVL_ALT_Q, roi->delta_q[i]);
+    }
+  }
+  roi->applied = 1;
+}
+
 #if !CONFIG_REALTIME_ONLY
 static void process_tpl_stats_frame(AV1_COMP *cpi) {
   const GF_GROUP *const gf_group = &cpi->ppi->gf_group;
@@ -1091,6 +1091,10 @@ BLOCK_SIZE av1_select_sb_size(const AV1EncoderConfig *const oxcf, int width,
 
 void av1_apply_active_map(AV1_COMP *cpi);
 
+// Codes the region of interest map set by av1_set_roi_map() as the
+// segmentation of the current frame, or removes it once it is disabled.
+void av1_apply_roi_map(AV1_COMP *cpi);
+
 #if !CONFIG_REALTIME_ONLY
 uint16_t av1_setup_interp_filter_search_mask(AV1_COMP *cpi);
 
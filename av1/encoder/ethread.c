@@ -1011,16 +1011,20 @@ void av1_init_tile_thread_data(AV1_PRIMARY *ppi, int is_first_pass) {
         AOM_CHECK_MEM_ERROR(&ppi->error, td->palette_buffer,
                             aom_memalign(16, sizeof(*td->palette_buffer)));
 
-        // The buffers 'tmp_pred_bufs[]', 'comp_rd_buffer' and 'obmc_buffer' are
-        // used in inter frames to store intermediate inter mode prediction
-        // results and are not required for allintra encoding mode. Hence, the
-        // memory allocations for these buffers are avoided for allintra
-        // encoding mode.
+        // The buffers 'tmp_pred_bufs[]', 'comp_rd_buffer', 'interp_pred_cache',
+        // 'subpel_plane_cache' and 'obmc_buffer' are used in inter frames to
+        // store intermediate inter mode prediction results and are not
+        // required for allintra encoding mode. Hence, the memory allocations
+        // for these buffers are avoided for allintra encoding mode.
         if (ppi->cpi->oxcf.kf_cfg.key_freq_max != 0) {
           alloc_obmc_buffers(&td->obmc_buffer, &ppi->error);
 
           alloc_compound_type_rd_buffers(&ppi->error, &td->comp_rd_buffer);
 
+          alloc_interp_pred_cache(&ppi->error, &td->interp_pred_cache);
+
+          alloc_subpel_plane_cache(&ppi->error, &td->subpel_plane_cache);
+
           for (int j = 0; j < 2; ++j) {
             AOM_CHECK_MEM_ERROR(
                 &ppi->error, td->tmp_pred_bufs[j],
@@ -1637,6 +1641,10 @@ static inline void prepare_enc_workers(AV1_COMP *cpi, AVxWorkerHook hook,
     if (i > 0) {
       thread_data->td->mb.palette_buffer = thread_data->td->palette_buffer;
       thread_data->td->mb.comp_rd_buffer = thread_data->td->comp_rd_buffer;
+      thread_data->td->mb.interp_pred_cache =
+          thread_data->td->interp_pred_cache;
+      thread_data->td->mb.subpel_plane_cache =
+          thread_data->td->subpel_plane_cache;
       thread_data->td->mb.tmp_conv_dst = thread_data->td->tmp_conv_dst;
       for (int j = 0; j < 2; ++j) {
         thread_data->td->mb.tmp_pred_bufs[j] =
@@ -2489,17 +2497,21 @@ static void tf_dealloc_thread_data(AV1_COMP *cpi, int num_workers,
   }
 }
 
-// Accumulate sse and sum after temporal filtering.
+// Accumulate sse, sum and block counts after temporal filtering.
 static void tf_accumulate_frame_diff(AV1_COMP *cpi, int num_workers) {
   FRAME_DIFF *total_diff = &cpi->td.tf_data.diff;
+  TF_FRAME_STATS *total_stats = &cpi->td.tf_data.stats;
   for (int i = num_workers - 1; i >= 0; i--) {
     AVxWorker *const worker = &cpi->mt_info.workers[i];
     EncWorkerData *const thread_data = (EncWorkerData *)worker->data1;
     ThreadData *td = thread_data->td;
     FRAME_DIFF *diff = &td->tf_data.diff;
+    const TF_FRAME_STATS *stats = &td->tf_data.stats;
     if (td != &cpi->td) {
       total_diff->sse += diff->sse;
       total_diff->sum += diff->sum;
+      total_stats->ref_blocks_filtered += stats->ref_blocks_filtered;
+      total_stats->ref_blocks_skipped += stats->ref_blocks_skipped;
     }
   }
 }
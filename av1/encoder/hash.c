@@ -53,6 +53,21 @@ static void crc_calculator_init_table(CRC_CALCULATOR *p_crc_calculator) {
   }
 }
 
+static void crc_calculator_init_slice_table(CRC_CALCULATOR *p_crc_calculator) {
+  const uint32_t mask = p_crc_calculator->final_result_mask;
+
+  for (uint32_t value = 0; value < 256; value++) {
+    uint32_t remainder = p_crc_calculator->table[value] & mask;
+    p_crc_calculator->slice_table[0][value] = remainder;
+    for (int k = 1; k < 16; k++) {
+      const uint8_t index =
+          (uint8_t)(remainder >> (p_crc_calculator->bits - 8));
+      remainder = ((remainder << 8) ^ p_crc_calculator->table[index]) & mask;
+      p_crc_calculator->slice_table[k][value] = remainder;
+    }
+  }
+}
+
 void av1_crc_calculator_init(CRC_CALCULATOR *p_crc_calculator, uint32_t bits,
                              uint32_t truncPoly) {
   p_crc_calculator->remainder = 0;
@@ -60,6 +75,7 @@ void av1_crc_calculator_init(CRC_CALCULATOR *p_crc_calculator, uint32_t bits,
   p_crc_calculator->trunc_poly = truncPoly;
   p_crc_calculator->final_result_mask = (1 << bits) - 1;
   crc_calculator_init_table(p_crc_calculator);
+  crc_calculator_init_slice_table(p_crc_calculator);
 }
 
 uint32_t av1_get_crc_value(CRC_CALCULATOR *p_crc_calculator, uint8_t *p,
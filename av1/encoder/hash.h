@@ -26,6 +26,10 @@ typedef struct _crc_calculator {
   uint32_t bits;
   uint32_t table[256];
   uint32_t final_result_mask;
+  // slice_table[k][v] is the crc of byte v followed by k zero bytes. The crc
+  // is linear, so a message of up to 16 bytes hashes to the xor of one
+  // lookup per byte, and the lookups do not depend on each other.
+  uint32_t slice_table[16][256];
 } CRC_CALCULATOR;
 
 // Initialize the crc calculator. It must be executed at least once before
@@ -35,6 +39,39 @@ void av1_crc_calculator_init(CRC_CALCULATOR *p_crc_calculator, uint32_t bits,
 uint32_t av1_get_crc_value(CRC_CALCULATOR *p_crc_calculator, uint8_t *p,
                            int length);
 
+// The functions below return the same value as av1_get_crc_value() on the
+// bytes of a 2x2 block of pixels or of four 32-bit words, stored in little
+// endian order, without first gathering them into a buffer.
+static inline uint32_t av1_get_crc_value_2x2(
+    const CRC_CALCULATOR *p_crc_calculator, const uint8_t *p, int stride) {
+  const uint32_t(*t)[256] = p_crc_calculator->slice_table;
+  return t[3][p[0]] ^ t[2][p[1]] ^ t[1][p[stride]] ^ t[0][p[stride + 1]];
+}
+
+static inline uint32_t crc_slice_u16(const uint32_t (*t)[256], uint16_t v) {
+  return t[1][v & 0xff] ^ t[0][v >> 8];
+}
+
+static inline uint32_t av1_get_crc_value_2x2_highbd(
+    const CRC_CALCULATOR *p_crc_calculator, const uint16_t *p, int stride) {
+  const uint32_t(*t)[256] = p_crc_calculator->slice_table;
+  return crc_slice_u16(t + 6, p[0]) ^ crc_slice_u16(t + 4, p[1]) ^
+         crc_slice_u16(t + 2, p[stride]) ^ crc_slice_u16(t, p[stride + 1]);
+}
+
+static inline uint32_t crc_slice_u32(const uint32_t (*t)[256], uint32_t v) {
+  return t[3][v & 0xff] ^ t[2][(v >> 8) & 0xff] ^ t[1][(v >> 16) & 0xff] ^
+         t[0][v >> 24];
+}
+
+static inline uint32_t av1_get_crc_value_u32x4(
+    const CRC_CALCULATOR *p_crc_calculator, uint32_t v0, uint32_t v1,
+    uint32_t v2, uint32_t v3) {
+  const uint32_t(*t)[256] = p_crc_calculator->slice_table;
+  return crc_slice_u32(t + 12, v0) ^ crc_slice_u32(t + 8, v1) ^
+         crc_slice_u32(t + 4, v2) ^ crc_slice_u32(t, v3);
+}
+
 // CRC32C: POLY = 0x82f63b78;
 typedef struct _CRC32C {
   /* Table for a quadword-at-a-time software crc. */
@@ -22,62 +22,6 @@
 #define kBlockSizeBits 3
 #define kMaxAddr (1 << (kSrcBits + kBlockSizeBits))
 
-// TODO(youzhou@microsoft.com): is higher than 8 bits screen content supported?
-// If yes, fix this function
-static void get_pixels_in_1D_char_array_by_block_2x2(const uint8_t *y_src,
-                                                     int stride,
-                                                     uint8_t *p_pixels_in1D) {
-  const uint8_t *p_pel = y_src;
-  int index = 0;
-  for (int i = 0; i < 2; i++) {
-    for (int j = 0; j < 2; j++) {
-      p_pixels_in1D[index++] = p_pel[j];
-    }
-    p_pel += stride;
-  }
-}
-
-static void get_pixels_in_1D_short_array_by_block_2x2(const uint16_t *y_src,
-                                                      int stride,
-                                                      uint16_t *p_pixels_in1D) {
-  const uint16_t *p_pel = y_src;
-  int index = 0;
-  for (int i = 0; i < 2; i++) {
-    for (int j = 0; j < 2; j++) {
-      p_pixels_in1D[index++] = p_pel[j];
-    }
-    p_pel += stride;
-  }
-}
-
-static int is_block_2x2_row_same_value(const uint8_t *p) {
-  if (p[0] != p[1] || p[2] != p[3]) {
-    return 0;
-  }
-  return 1;
-}
-
-static int is_block16_2x2_row_same_value(const uint16_t *p) {
-  if (p[0] != p[1] || p[2] != p[3]) {
-    return 0;
-  }
-  return 1;
-}
-
-static int is_block_2x2_col_same_value(const uint8_t *p) {
-  if ((p[0] != p[2]) || (p[1] != p[3])) {
-    return 0;
-  }
-  return 1;
-}
-
-static int is_block16_2x2_col_same_value(const uint16_t *p) {
-  if ((p[0] != p[2]) || (p[1] != p[3])) {
-    return 0;
-  }
-  return 1;
-}
-
 // the hash value (hash_value1 consists two parts, the first 3 bits relate to
 // the block size and the remaining 16 bits are the crc values. This fuction
 // is used to get the first 3 bits.
@@ -178,45 +122,41 @@ void av1_generate_block_2x2_hash_value(IntraBCHashInfo *intrabc_hash_info,
   const int height = 2;
   const int x_end = picture->y_crop_width - width + 1;
   const int y_end = picture->y_crop_height - height + 1;
-  CRC_CALCULATOR *calc_1 = &intrabc_hash_info->crc_calculator1;
-  CRC_CALCULATOR *calc_2 = &intrabc_hash_info->crc_calculator2;
+  const int stride = picture->y_stride;
+  const CRC_CALCULATOR *calc_1 = &intrabc_hash_info->crc_calculator1;
+  const CRC_CALCULATOR *calc_2 = &intrabc_hash_info->crc_calculator2;
 
-  const int length = width * 2;
+  // The blocks are hashed in place, so each row of results only reads two
+  // rows of the frame.
   if (picture->flags & YV12_FLAG_HIGHBITDEPTH) {
-    uint16_t p[4];
     int pos = 0;
     for (int y_pos = 0; y_pos < y_end; y_pos++) {
-      for (int x_pos = 0; x_pos < x_end; x_pos++) {
-        get_pixels_in_1D_short_array_by_block_2x2(
-            CONVERT_TO_SHORTPTR(picture->y_buffer) + y_pos * picture->y_stride +
-                x_pos,
-            picture->y_stride, p);
-        pic_block_same_info[0][pos] = is_block16_2x2_row_same_value(p);
-        pic_block_same_info[1][pos] = is_block16_2x2_col_same_value(p);
-
+      const uint16_t *p = CONVERT_TO_SHORTPTR(picture->y_buffer) +
+                          (ptrdiff_t)y_pos * stride;
+      for (int x_pos = 0; x_pos < x_end; x_pos++, p++) {
+        pic_block_same_info[0][pos] =
+            p[0] == p[1] && p[stride] == p[stride + 1];
+        pic_block_same_info[1][pos] =
+            p[0] == p[stride] && p[1] == p[stride + 1];
         pic_block_hash[0][pos] =
-            av1_get_crc_value(calc_1, (uint8_t *)p, length * sizeof(p[0]));
+            av1_get_crc_value_2x2_highbd(calc_1, p, stride);
         pic_block_hash[1][pos] =
-            av1_get_crc_value(calc_2, (uint8_t *)p, length * sizeof(p[0]));
+            av1_get_crc_value_2x2_highbd(calc_2, p, stride);
         pos++;
       }
       pos += width - 1;
     }
   } else {
-    uint8_t p[4];
     int pos = 0;
     for (int y_pos = 0; y_pos < y_end; y_pos++) {
-      for (int x_pos = 0; x_pos < x_end; x_pos++) {
-        get_pixels_in_1D_char_array_by_block_2x2(
-            picture->y_buffer + y_pos * picture->y_stride + x_pos,
-            picture->y_stride, p);
-        pic_block_same_info[0][pos] = is_block_2x2_row_same_value(p);
-        pic_block_same_info[1][pos] = is_block_2x2_col_same_value(p);
-
-        pic_block_hash[0][pos] =
-            av1_get_crc_value(calc_1, p, length * sizeof(p[0]));
-        pic_block_hash[1][pos] =
-            av1_get_crc_value(calc_2, p, length * sizeof(p[0]));
+      const uint8_t *p = picture->y_buffer + (ptrdiff_t)y_pos * stride;
+      for (int x_pos = 0; x_pos < x_end; x_pos++, p++) {
+        pic_block_same_info[0][pos] =
+            p[0] == p[1] && p[stride] == p[stride + 1];
+        pic_block_same_info[1][pos] =
+            p[0] == p[stride] && p[1] == p[stride + 1];
+        pic_block_hash[0][pos] = av1_get_crc_value_2x2(calc_1, p, stride);
+        pic_block_hash[1][pos] = av1_get_crc_value_2x2(calc_2, p, stride);
         pos++;
       }
       pos += width - 1;
@@ -231,8 +171,8 @@ void av1_generate_block_hash_value(IntraBCHashInfo *intrabc_hash_info,
                                    uint32_t *dst_pic_block_hash[2],
                                    int8_t *src_pic_block_same_info[3],
                                    int8_t *dst_pic_block_same_info[3]) {
-  CRC_CALCULATOR *calc_1 = &intrabc_hash_info->crc_calculator1;
-  CRC_CALCULATOR *calc_2 = &intrabc_hash_info->crc_calculator2;
+  const CRC_CALCULATOR *calc_1 = &intrabc_hash_info->crc_calculator1;
+  const CRC_CALCULATOR *calc_2 = &intrabc_hash_info->crc_calculator2;
 
   const int pic_width = picture->y_crop_width;
   const int x_end = picture->y_crop_width - block_size + 1;
@@ -241,25 +181,18 @@ void av1_generate_block_hash_value(IntraBCHashInfo *intrabc_hash_info,
   const int src_size = block_size >> 1;
   const int quad_size = block_size >> 2;
 
-  uint32_t p[4];
-  const int length = sizeof(p);
-
   int pos = 0;
   for (int y_pos = 0; y_pos < y_end; y_pos++) {
     for (int x_pos = 0; x_pos < x_end; x_pos++) {
-      p[0] = src_pic_block_hash[0][pos];
-      p[1] = src_pic_block_hash[0][pos + src_size];
-      p[2] = src_pic_block_hash[0][pos + src_size * pic_width];
-      p[3] = src_pic_block_hash[0][pos + src_size * pic_width + src_size];
-      dst_pic_block_hash[0][pos] =
-          av1_get_crc_value(calc_1, (uint8_t *)p, length);
-
-      p[0] = src_pic_block_hash[1][pos];
-      p[1] = src_pic_block_hash[1][pos + src_size];
-      p[2] = src_pic_block_hash[1][pos + src_size * pic_width];
-      p[3] = src_pic_block_hash[1][pos + src_size * pic_width + src_size];
-      dst_pic_block_hash[1][pos] =
-          av1_get_crc_value(calc_2, (uint8_t *)p, length);
+      const uint32_t *h = src_pic_block_hash[0] + pos;
+      dst_pic_block_hash[0][pos] = av1_get_crc_value_u32x4(
+          calc_1, h[0], h[src_size], h[src_size * pic_width],
+          h[src_size * pic_width + src_size]);
+
+      h = src_pic_block_hash[1] + pos;
+      dst_pic_block_hash[1][pos] = av1_get_crc_value_u32x4(
+          calc_2, h[0], h[src_size], h[src_size * pic_width],
+          h[src_size * pic_width + src_size]);
 
       dst_pic_block_same_info[0][pos] =
           src_pic_block_same_info[0][pos] &&
@@ -399,40 +332,32 @@ void av1_get_block_hash_value(IntraBCHashInfo *intrabc_hash_info,
   add_value <<= kSrcBits;
   const int crc_mask = (1 << kSrcBits) - 1;
 
-  CRC_CALCULATOR *calc_1 = &intrabc_hash_info->crc_calculator1;
-  CRC_CALCULATOR *calc_2 = &intrabc_hash_info->crc_calculator2;
+  const CRC_CALCULATOR *calc_1 = &intrabc_hash_info->crc_calculator1;
+  const CRC_CALCULATOR *calc_2 = &intrabc_hash_info->crc_calculator2;
   uint32_t **buf_1 = intrabc_hash_info->hash_value_buffer[0];
   uint32_t **buf_2 = intrabc_hash_info->hash_value_buffer[1];
 
   // 2x2 subblock hash values in current CU
   int sub_block_in_width = (block_size >> 1);
   if (use_highbitdepth) {
-    uint16_t pixel_to_hash[4];
-    uint16_t *y16_src = CONVERT_TO_SHORTPTR(y_src);
+    const uint16_t *y16_src = CONVERT_TO_SHORTPTR(y_src);
     for (int y_pos = 0; y_pos < block_size; y_pos += 2) {
       for (int x_pos = 0; x_pos < block_size; x_pos += 2) {
         int pos = (y_pos >> 1) * sub_block_in_width + (x_pos >> 1);
-        get_pixels_in_1D_short_array_by_block_2x2(
-            y16_src + y_pos * stride + x_pos, stride, pixel_to_hash);
+        const uint16_t *p = y16_src + y_pos * stride + x_pos;
         assert(pos < AOM_BUFFER_SIZE_FOR_BLOCK_HASH);
-        buf_1[0][pos] = av1_get_crc_value(calc_1, (uint8_t *)pixel_to_hash,
-                                          sizeof(pixel_to_hash));
-        buf_2[0][pos] = av1_get_crc_value(calc_2, (uint8_t *)pixel_to_hash,
-                                          sizeof(pixel_to_hash));
+        buf_1[0][pos] = av1_get_crc_value_2x2_highbd(calc_1, p, stride);
+        buf_2[0][pos] = av1_get_crc_value_2x2_highbd(calc_2, p, stride);
       }
     }
   } else {
-    uint8_t pixel_to_hash[4];
     for (int y_pos = 0; y_pos < block_size; y_pos += 2) {
       for (int x_pos = 0; x_pos < block_size; x_pos += 2) {
         int pos = (y_pos >> 1) * sub_block_in_width + (x_pos >> 1);
-        get_pixels_in_1D_char_array_by_block_2x2(y_src + y_pos * stride + x_pos,
-                                                 stride, pixel_to_hash);
+        const uint8_t *p = y_src + y_pos * stride + x_pos;
         assert(pos < AOM_BUFFER_SIZE_FOR_BLOCK_HASH);
-        buf_1[0][pos] =
-            av1_get_crc_value(calc_1, pixel_to_hash, sizeof(pixel_to_hash));
-        buf_2[0][pos] =
-            av1_get_crc_value(calc_2, pixel_to_hash, sizeof(pixel_to_hash));
+        buf_1[0][pos] = av1_get_crc_value_2x2(calc_1, p, stride);
+        buf_2[0][pos] = av1_get_crc_value_2x2(calc_2, p, stride);
       }
     }
   }
@@ -444,7 +369,6 @@ void av1_get_block_hash_value(IntraBCHashInfo *intrabc_hash_info,
   int dst_idx = 0;
 
   // 4x4 subblock hash values to current block hash values
-  uint32_t to_hash[4];
   for (int sub_width = 4; sub_width <= block_size; sub_width *= 2) {
     src_idx = 1 - src_idx;
     dst_idx = 1 - dst_idx;
@@ -458,20 +382,15 @@ void av1_get_block_hash_value(IntraBCHashInfo *intrabc_hash_info,
         assert(srcPos + src_sub_block_in_width + 1 <
                AOM_BUFFER_SIZE_FOR_BLOCK_HASH);
         assert(dst_pos < AOM_BUFFER_SIZE_FOR_BLOCK_HASH);
-        to_hash[0] = buf_1[src_idx][srcPos];
-        to_hash[1] = buf_1[src_idx][srcPos + 1];
-        to_hash[2] = buf_1[src_idx][srcPos + src_sub_block_in_width];
-        to_hash[3] = buf_1[src_idx][srcPos + src_sub_block_in_width + 1];
-
-        buf_1[dst_idx][dst_pos] =
-            av1_get_crc_value(calc_1, (uint8_t *)to_hash, sizeof(to_hash));
-
-        to_hash[0] = buf_2[src_idx][srcPos];
-        to_hash[1] = buf_2[src_idx][srcPos + 1];
-        to_hash[2] = buf_2[src_idx][srcPos + src_sub_block_in_width];
-        to_hash[3] = buf_2[src_idx][srcPos + src_sub_block_in_width + 1];
-        buf_2[dst_idx][dst_pos] =
-            av1_get_crc_value(calc_2, (uint8_t *)to_hash, sizeof(to_hash));
+        const uint32_t *h = buf_1[src_idx] + srcPos;
+        buf_1[dst_idx][dst_pos] = av1_get_crc_value_u32x4(
+            calc_1, h[0], h[1], h[src_sub_block_in_width],
+            h[src_sub_block_in_width + 1]);
+
+        h = buf_2[src_idx] + srcPos;
+        buf_2[dst_idx][dst_pos] = av1_get_crc_value_u32x4(
+            calc_2, h[0], h[1], h[src_sub_block_in_width],
+            h[src_sub_block_in_width + 1]);
         dst_pos++;
       }
     }
@@ -134,8 +134,13 @@ static inline void interp_model_rd_eval(
   if (!is_skip_build_pred) {
     const int mi_row = xd->mi_row;
     const int mi_col = xd->mi_col;
-    av1_enc_build_inter_predictor(cm, xd, mi_row, mi_col, orig_dst, bsize,
-                                  plane_from, plane_to);
+    // Luma predictors sharing the x filter reuse the cached horizontal pass.
+    if (plane_to != AOM_PLANE_Y ||
+        !av1_enc_build_inter_predictor_y_cached(xd, mi_row, mi_col,
+                                                &x->interp_pred_cache)) {
+      av1_enc_build_inter_predictor(cm, xd, mi_row, mi_col, orig_dst, bsize,
+                                    plane_from, plane_to);
+    }
   }
 
   model_rd_sb_fn[cpi->sf.rt_sf.use_simple_rd_model
@@ -692,6 +697,10 @@ int64_t av1_interpolation_filter_search(
       get_switchable_rate(x, mbmi->interp_filters, switchable_ctx,
                           cm->seq_params->enable_dual_filter);
 
+  // Horizontal passes cached by an earlier search belong to another MV or
+  // reference.
+  x->interp_pred_cache.valid_mask = 0;
+
   // Do MC evaluation for default filter_type.
   // Luma MC
   interp_model_rd_eval(x, cpi, bsize, orig_dst, AOM_PLANE_Y, AOM_PLANE_Y,
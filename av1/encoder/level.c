@@ -472,6 +472,53 @@ static double time_to_decode_frame(const AV1_COMMON *const cm,
   return luma_samples / (double)max_decode_rate;
 }
 
+static int compare_tile_area(const void *a, const void *b) {
+  const int64_t area_a = *(const int64_t *)a;
+  const int64_t area_b = *(const int64_t *)b;
+  return (area_a < area_b) - (area_a > area_b);
+}
+
+double av1_estimate_frame_decode_time(const AV1_COMP *cpi, int num_threads) {
+  const AV1_COMMON *const cm = &cpi->common;
+  const CommonTileParams *const tiles = &cm->tiles;
+  AV1_LEVEL level = cm->seq_params->seq_level_idx[0];
+  if (level >= SEQ_LEVELS || av1_level_defs[level].max_decode_rate == 0)
+    level = SEQ_LEVEL_6_3;
+  const double frame_time =
+      time_to_decode_frame(cm, av1_level_defs[level].max_decode_rate);
+  if (frame_time == 0.0) return 0.0;
+
+  // Hand the tiles, largest first, to the least loaded thread, which is what
+  // a tile based multi-threaded decoder approximately does.
+  int64_t tile_area[MAX_TILE_ROWS * MAX_TILE_COLS];
+  int64_t load[MAX_NUM_THREADS] = { 0 };
+  int64_t total_area = 0;
+  int num_tiles = 0;
+  num_threads = clamp(num_threads, 1, MAX_NUM_THREADS);
+  for (int row = 0; row < tiles->rows; ++row) {
+    for (int col = 0; col < tiles->cols; ++col) {
+      TileInfo tile_info;
+      av1_tile_init(&tile_info, cm, row, col);
+      tile_area[num_tiles] =
+          (int64_t)(tile_info.mi_row_end - tile_info.mi_row_start) *
+          (tile_info.mi_col_end - tile_info.mi_col_start);
+      total_area += tile_area[num_tiles++];
+    }
+  }
+  if (total_area == 0) return frame_time;
+  qsort(tile_area, num_tiles, sizeof(*tile_area), compare_tile_area);
+  int64_t max_load = 0;
+  for (int i = 0; i < num_tiles; ++i) {
+    int64_t *min_load = &load[0];
+    for (int t = 1; t < num_threads; ++t) {
+      if (load[t] < *min_load) min_load = &load[t];
+    }
+    *min_load += tile_area[i];
+    max_load = AOMMAX(max_load, *min_load);
+  }
+  return frame_time * num_threads * max_load / total_area;
+}
+
 // Release frame buffers that are no longer needed for decode or display.
 // It corresponds to "start_decode_at_removal_time" in the spec.
 static void release_processed_frames(DECODER_MODEL *const decoder_model,
@@ -208,4 +208,10 @@ void av1_get_max_tiles_for_level(AV1_LEVEL level_index, int *const max_tiles,
 // Return minimum compression ratio for given level.
 double av1_get_min_cr_for_level(AV1_LEVEL level_index, int tier,
                                 int is_still_picture);
+
+// Return the time (in seconds) needed to decode the current frame by a decoder
+// of the sequence level whose decode rate is shared evenly by num_threads
+// threads, each decoding whole tiles.
+double av1_estimate_frame_decode_time(const struct AV1_COMP *cpi,
+                                      int num_threads);
 #endif  // AOM_AV1_ENCODER_LEVEL_H_
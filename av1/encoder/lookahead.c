@@ -15,6 +15,7 @@
 
 #include "aom_scale/yv12config.h"
 #include "av1/common/common.h"
+#include "av1/common/resize.h"
 #include "av1/encoder/encoder.h"
 #include "av1/encoder/extend.h"
 #include "av1/encoder/lookahead.h"
@@ -98,6 +99,36 @@ int av1_lookahead_full(const struct lookahead_ctx *ctx) {
   return ctx->read_ctxs[ENCODE_STAGE].sz >= ctx->read_ctxs[ENCODE_STAGE].pop_sz;
 }
 
+/* Claim the next entry to write, or return NULL if the queue is full */
+static struct lookahead_entry *push_entry(struct lookahead_ctx *ctx) {
+  assert(ctx->read_ctxs[ENCODE_STAGE].valid == 1);
+  if (ctx->read_ctxs[ENCODE_STAGE].sz + ctx->max_pre_frames > ctx->max_sz)
+    return NULL;
+
+  ctx->read_ctxs[ENCODE_STAGE].sz++;
+  if (ctx->read_ctxs[LAP_STAGE].valid) {
+    ctx->read_ctxs[LAP_STAGE].sz++;
+  }
+
+  return pop(ctx, &ctx->write_idx);
+}
+
+static int finish_entry(struct lookahead_ctx *ctx, struct lookahead_entry *buf,
+                        const YV12_BUFFER_CONFIG *src, int64_t ts_start,
+                        int64_t ts_end, aom_enc_frame_flags_t flags) {
+  buf->ts_start = ts_start;
+  buf->ts_end = ts_end;
+  buf->display_idx = ctx->push_frame_count;
+  buf->flags = flags;
+  ++ctx->push_frame_count;
+  aom_remove_metadata_from_frame_buffer(&buf->img);
+  if (src->metadata &&
+      aom_copy_metadata_to_frame_buffer(&buf->img, src->metadata)) {
+    return 1;
+  }
+  return 0;
+}
+
 int av1_lookahead_push(struct lookahead_ctx *ctx, const YV12_BUFFER_CONFIG *src,
                        int64_t ts_start, int64_t ts_end, int use_highbitdepth,
                        bool alloc_pyramid, aom_enc_frame_flags_t flags) {
@@ -109,16 +140,8 @@ int av1_lookahead_push(struct lookahead_ctx *ctx, const YV12_BUFFER_CONFIG *src,
   int subsampling_y = src->subsampling_y;
   int larger_dimensions, new_dimensions;
 
-  assert(ctx->read_ctxs[ENCODE_STAGE].valid == 1);
-  if (ctx->read_ctxs[ENCODE_STAGE].sz + ctx->max_pre_frames > ctx->max_sz)
-    return 1;
-
-  ctx->read_ctxs[ENCODE_STAGE].sz++;
-  if (ctx->read_ctxs[LAP_STAGE].valid) {
-    ctx->read_ctxs[LAP_STAGE].sz++;
-  }
-
-  struct lookahead_entry *buf = pop(ctx, &ctx->write_idx);
+  struct lookahead_entry *buf = push_entry(ctx);
+  if (!buf) return 1;
 
   new_dimensions = width != buf->img.y_crop_width ||
                    height != buf->img.y_crop_height ||
@@ -152,17 +175,37 @@ int av1_lookahead_push(struct lookahead_ctx *ctx, const YV12_BUFFER_CONFIG *src,
   }
   av1_copy_and_extend_frame(src, &buf->img);
 
-  buf->ts_start = ts_start;
-  buf->ts_end = ts_end;
-  buf->display_idx = ctx->push_frame_count;
-  buf->flags = flags;
-  ++ctx->push_frame_count;
-  aom_remove_metadata_from_frame_buffer(&buf->img);
-  if (src->metadata &&
-      aom_copy_metadata_to_frame_buffer(&buf->img, src->metadata)) {
-    return 1;
+  return finish_entry(ctx, buf, src, ts_start, ts_end, flags);
+}
+
+YV12_BUFFER_CONFIG *av1_lookahead_push_scaled(
+    struct lookahead_ctx *ctx, const YV12_BUFFER_CONFIG *src, int width,
+    int height, int bit_depth, int64_t ts_start, int64_t ts_end,
+    int use_highbitdepth, bool alloc_pyramid, aom_enc_frame_flags_t flags) {
+  struct lookahead_entry *buf = push_entry(ctx);
+  if (!buf) return NULL;
+
+  // The target size only changes with the encoder configuration, so simply
+  // reallocate on any mismatch.
+  if (buf->img.y_crop_width != width || buf->img.y_crop_height != height ||
+      buf->img.subsampling_x != src->subsampling_x ||
+      buf->img.subsampling_y != src->subsampling_y) {
+    YV12_BUFFER_CONFIG new_img;
+    memset(&new_img, 0, sizeof(new_img));
+    if (aom_alloc_frame_buffer(&new_img, width, height, src->subsampling_x,
+                               src->subsampling_y, use_highbitdepth,
+                               AOM_BORDER_IN_PIXELS, 0, alloc_pyramid, 0))
+      return NULL;
+    aom_free_frame_buffer(&buf->img);
+    buf->img = new_img;
   }
-  return 0;
+  buf->img.monochrome = src->monochrome;
+  if (!av1_resize_and_extend_frame_nonnormative(src, &buf->img, bit_depth,
+                                                src->monochrome ? 1 : 3))
+    return NULL;
+
+  if (finish_entry(ctx, buf, src, ts_start, ts_end, flags)) return NULL;
+  return &buf->img;
 }
 
 struct lookahead_entry *av1_lookahead_pop(struct lookahead_ctx *ctx, int drain,
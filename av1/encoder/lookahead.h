@@ -98,6 +98,30 @@ int av1_lookahead_push(struct lookahead_ctx *ctx, const YV12_BUFFER_CONFIG *src,
                        int64_t ts_start, int64_t ts_end, int use_highbitdepth,
                        bool alloc_pyramid, aom_enc_frame_flags_t flags);
 
+/**\brief Enqueue a source buffer, resampling it to the given size
+ *
+ * This function will scale the source image into a framebuffer of
+ * \c width x \c height with the non-normative scaler, instead of copying it.
+ *
+ * \param[in] ctx               Pointer to the lookahead context
+ * \param[in] src               Pointer to the image to enqueue
+ * \param[in] width             Width of the enqueued frame
+ * \param[in] height            Height of the enqueued frame
+ * \param[in] bit_depth         Bit depth of the source image
+ * \param[in] ts_start          Timestamp for the start of this frame
+ * \param[in] ts_end            Timestamp for the end of this frame
+ * \param[in] use_highbitdepth  Tell if HBD is used
+ * \param[in] alloc_pyramid     Whether to allocate a downsampling pyramid
+ *                              for each frame buffer
+ * \param[in] flags             Flags set on this frame
+ *
+ * \retval Return the enqueued frame, or NULL on failure.
+ */
+YV12_BUFFER_CONFIG *av1_lookahead_push_scaled(
+    struct lookahead_ctx *ctx, const YV12_BUFFER_CONFIG *src, int width,
+    int height, int bit_depth, int64_t ts_start, int64_t ts_end,
+    int use_highbitdepth, bool alloc_pyramid, aom_enc_frame_flags_t flags);
+
 /**\brief Get the next source buffer to encode
  *
  * \param[in] ctx       Pointer to the lookahead context
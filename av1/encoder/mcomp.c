@@ -185,6 +185,17 @@ void av1_make_default_subpel_ms_params(SUBPEL_MOTION_SEARCH_PARAMS *ms_params,
   // Ref and src buffers
   MSBuffers *ms_buffers = &ms_params->var_params.ms_buffers;
   init_ms_buffers(ms_buffers, x);
+
+  ms_params->var_params.plane_cache =
+      x->subpel_plane_cache.active ? &x->subpel_plane_cache : NULL;
+}
+
+void av1_subpel_plane_cache_start_sb(SubpelPlaneCache *cache, int border) {
+  if (cache->tiles == NULL) return;
+  memset(cache->tags, 0, SUBPEL_PLANE_CACHE_TILES * sizeof(*cache->tags));
+  // Keep the 8-tap filter support of every cached pixel inside the border.
+  cache->margin = border - 2 * AOM_INTERP_EXTEND;
+  cache->active = cache->margin > 0;
 }
 
 void av1_set_mv_search_range(FullMvLimits *mv_limits, const MV *mv) {
@@ -686,6 +697,26 @@ static inline int get_mvpred_sad(const FULLPEL_MOTION_SEARCH_PARAMS *ms_params,
   return ms_params->sdf(src_buf, src_stride, ref_address, ref_stride);
 }
 
+// Computes the sads of the ref blocks at the addresses in 'ref_addrs'. The
+// candidates are evaluated 4 at a time with sdx4df, so that rings which are
+// partially outside of the mv limits still use the multi-candidate kernel for
+// their remaining candidates.
+static inline void get_mvpred_sad_multi(
+    const FULLPEL_MOTION_SEARCH_PARAMS *ms_params,
+    const struct buf_2d *const src, const uint8_t *const *ref_addrs,
+    const int ref_stride, const int num_addrs, unsigned int *sads) {
+  const uint8_t *src_buf = src->buf;
+  const int src_stride = src->stride;
+  int i = 0;
+
+  for (; i + 4 <= num_addrs; i += 4) {
+    ms_params->sdx4df(src_buf, src_stride, ref_addrs + i, ref_stride,
+                      sads + i);
+  }
+  for (; i < num_addrs; i++)
+    sads[i] = ms_params->sdf(src_buf, src_stride, ref_addrs[i], ref_stride);
+}
+
 static inline int get_mvpred_compound_var_cost(
     const FULLPEL_MOTION_SEARCH_PARAMS *ms_params, const FULLPEL_MV *this_mv,
     FULLPEL_MV_STATS *mv_stats) {
@@ -959,18 +990,32 @@ static inline void calc_sad_update_bestmv(
   const struct buf_2d *const src = ms_params->ms_buffers.src;
   const struct buf_2d *const ref = ms_params->ms_buffers.ref;
   const search_site *site = ms_params->search_sites->site[search_step];
-  // Loop over number of candidates.
+  const uint8_t *ref_addrs[MAX_PATTERN_SITES];
+  unsigned int sads[MAX_PATTERN_SITES];
+  int site_idx[MAX_PATTERN_SITES];
+  int num_in_range = 0;
+  assert(num_candidates - cand_start <= MAX_PATTERN_SITES);
+  // Gather the candidates inside the mv limits and compute their sads
+  // together.
   for (int i = cand_start; i < num_candidates; i++) {
     const FULLPEL_MV this_mv = { center_mv.row + site[i].mv.row,
                                  center_mv.col + site[i].mv.col };
     if (!av1_is_fullmv_in_range(&ms_params->mv_limits, this_mv)) continue;
-    int thissad = get_mvpred_sad(ms_params, src,
-                                 center_address + site[i].offset, ref->stride);
+    ref_addrs[num_in_range] = center_address + site[i].offset;
+    site_idx[num_in_range++] = i;
+  }
+  get_mvpred_sad_multi(ms_params, src, ref_addrs, ref->stride, num_in_range,
+                       sads);
+
+  for (int j = 0; j < num_in_range; j++) {
+    const int i = site_idx[j];
+    const FULLPEL_MV this_mv = { center_mv.row + site[i].mv.row,
+                                 center_mv.col + site[i].mv.col };
     if (cost_list) {
-      cost_list[i + 1] = thissad;
+      cost_list[i + 1] = sads[j];
     }
     const int found_better_mv = update_mvs_and_sad(
-        thissad, &this_mv, mv_cost_params, bestsad, raw_bestsad, best_mv,
+        sads[j], &this_mv, mv_cost_params, bestsad, raw_bestsad, best_mv,
         /*second_best_mv=*/NULL);
     if (found_better_mv) *best_site = i;
   }
@@ -1443,21 +1488,32 @@ static int diamond_search_sad(FULLPEL_MV start_mv, unsigned int start_mv_sad,
           }
         }
       } else {
+        const uint8_t *ref_addrs[MAX_PATTERN_SITES];
+        unsigned int sads[MAX_PATTERN_SITES];
+        int site_idx[MAX_PATTERN_SITES];
+        int num_in_range = 0;
+        assert(num_searches <= MAX_PATTERN_SITES);
         for (int idx = 1; idx <= num_searches; idx++) {
           const FULLPEL_MV this_mv = { best_mv->row + site[idx].mv.row,
                                        best_mv->col + site[idx].mv.col };
-
           if (av1_is_fullmv_in_range(&ms_params->mv_limits, this_mv)) {
-            const uint8_t *const check_here = site[idx].offset + best_address;
-            unsigned int thissad =
-                get_mvpred_sad(ms_params, src, check_here, ref_stride);
-
+            ref_addrs[num_in_range] = site[idx].offset + best_address;
+            site_idx[num_in_range++] = idx;
+          }
+        }
+        get_mvpred_sad_multi(ms_params, src, ref_addrs, ref_stride,
+                             num_in_range, sads);
+
+        for (int j = 0; j < num_in_range; j++) {
+          if (sads[j] < bestsad) {
+            const int idx = site_idx[j];
+            const FULLPEL_MV this_mv = { best_mv->row + site[idx].mv.row,
+                                         best_mv->col + site[idx].mv.col };
+            const unsigned int thissad =
+                sads[j] + mvsad_err_cost_(&this_mv, mv_cost_params);
             if (thissad < bestsad) {
-              thissad += mvsad_err_cost_(&this_mv, mv_cost_params);
-              if (thissad < bestsad) {
-                bestsad = thissad;
-                best_site = idx;
-              }
+              bestsad = thissad;
+              best_site = idx;
             }
           }
         }
@@ -2497,6 +2553,90 @@ static inline int estimated_pref_error(
   }
 }
 
+// Builds the upsampled prediction of the luma block at this_mv from the tiles
+// of the subpel plane cache, interpolating the missing tiles. Only half and
+// quarter pel positions of unscaled references are cached. Returns 0 if the
+// prediction can't be served by the cache.
+static int get_cached_upsampled_pred(MACROBLOCKD *xd, const AV1_COMMON *cm,
+                                     const MV *this_mv,
+                                     const SUBPEL_SEARCH_VAR_PARAMS *var_params,
+                                     uint8_t *pred) {
+  const SubpelPlaneCache *const cache = var_params->plane_cache;
+  const int subpel_x_q3 = get_subpel_part(this_mv->col);
+  const int subpel_y_q3 = get_subpel_part(this_mv->row);
+  if (cache == NULL || ((subpel_x_q3 | subpel_y_q3) & 1) ||
+      !(subpel_x_q3 | subpel_y_q3))
+    return 0;
+
+  const MB_MODE_INFO *const mi = xd->mi[0];
+  if (is_intrabc_block(mi) || av1_is_scaled(xd->block_ref_scale_factors[0]))
+    return 0;
+
+  // The tiles are addressed relative to the top-left pixel of the reference
+  // frame, which is only known if ref->buf is the unscaled block position.
+  const struct buf_2d *const ref = var_params->ms_buffers.ref;
+  const int ref_stride = ref->stride;
+  const uint8_t *const ref_origin = ref->buf0;
+  if (ref->buf !=
+      ref_origin + xd->mi_row * MI_SIZE * ref_stride + xd->mi_col * MI_SIZE)
+    return 0;
+
+  const int tile_log2 = SUBPEL_PLANE_CACHE_TILE_LOG2;
+  const int tile_size = 1 << tile_log2;
+  const int w = var_params->w;
+  const int h = var_params->h;
+  const int x0 = xd->mi_col * MI_SIZE + (this_mv->col >> 3);
+  const int y0 = xd->mi_row * MI_SIZE + (this_mv->row >> 3);
+  const int tile_col0 = x0 >> tile_log2;
+  const int tile_row0 = y0 >> tile_log2;
+  const int tile_col1 = (x0 + w - 1) >> tile_log2;
+  const int tile_row1 = (y0 + h - 1) >> tile_log2;
+  if ((tile_col0 << tile_log2) < -cache->margin ||
+      (tile_row0 << tile_log2) < -cache->margin ||
+      ((tile_col1 + 1) << tile_log2) > ref->width + cache->margin ||
+      ((tile_row1 + 1) << tile_log2) > ref->height + cache->margin)
+    return 0;
+  const int16_t phase = (int16_t)((var_params->subpel_search_type << 6) |
+                                  (subpel_y_q3 << 3) | subpel_x_q3);
+  const uint32_t origin_hash = (uint32_t)((uintptr_t)ref_origin >> 4);
+
+  // Tiles are filled and copied out one at a time, so that two tiles of the
+  // block sharing a cache slot can't overwrite each other before being read.
+  for (int tile_row = tile_row0; tile_row <= tile_row1; ++tile_row) {
+    const int ty = tile_row << tile_log2;
+    const int r0 = AOMMAX(y0, ty);
+    const int r1 = AOMMIN(y0 + h, ty + tile_size);
+    for (int tile_col = tile_col0; tile_col <= tile_col1; ++tile_col) {
+      const int tx = tile_col << tile_log2;
+      const uint32_t hash = origin_hash + (uint32_t)tile_row * 0x9E3779B1u +
+                            (uint32_t)tile_col * 0x85EBCA77u +
+                            (uint32_t)phase * 0xC2B2AE3Du;
+      const int idx = (hash >> 16) & (SUBPEL_PLANE_CACHE_TILES - 1);
+      SubpelPlaneTileTag *const tag = &cache->tags[idx];
+      uint8_t *const tile = cache->tiles + (idx << (2 * tile_log2));
+      if (tag->ref_origin != ref_origin || tag->row != tile_row ||
+          tag->col != tile_col || tag->phase != phase) {
+        aom_upsampled_pred(xd, cm, xd->mi_row, xd->mi_col, this_mv, tile,
+                           tile_size, tile_size, subpel_x_q3, subpel_y_q3,
+                           ref_origin + ty * ref_stride + tx, ref_stride,
+                           var_params->subpel_search_type);
+        tag->ref_origin = ref_origin;
+        tag->row = (int16_t)tile_row;
+        tag->col = (int16_t)tile_col;
+        tag->phase = phase;
+      }
+
+      const int c0 = AOMMAX(x0, tx);
+      const int c1 = AOMMIN(x0 + w, tx + tile_size);
+      for (int r = r0; r < r1; ++r) {
+        memcpy(pred + (r - y0) * w + (c0 - x0),
+               tile + ((r - ty) << tile_log2) + (c0 - tx), c1 - c0);
+      }
+    }
+  }
+  return 1;
+}
+
 // Calculates the variance of prediction residue.
 static int upsampled_pref_error(MACROBLOCKD *xd, const AV1_COMMON *cm,
                                 const MV *this_mv,
@@ -2547,7 +2687,16 @@ static int upsampled_pref_error(MACROBLOCKD *xd, const AV1_COMMON *cm,
     besterr = vfp->vf(pred8, w, src, src_stride, sse);
   } else {
     DECLARE_ALIGNED(16, uint8_t, pred[MAX_SB_SQUARE]);
-    if (second_pred != NULL) {
+    if (get_cached_upsampled_pred(xd, cm, this_mv, var_params, pred)) {
+      if (second_pred != NULL) {
+        if (mask) {
+          aom_comp_mask_pred(pred, second_pred, w, h, pred, w, mask,
+                             mask_stride, invert_mask);
+        } else {
+          aom_comp_avg_pred(pred, second_pred, w, h, pred, w);
+        }
+      }
+    } else if (second_pred != NULL) {
       if (mask) {
         aom_comp_mask_upsampled_pred(
             xd, cm, mi_row, mi_col, this_mv, pred, second_pred, w, h,
@@ -2568,7 +2717,16 @@ static int upsampled_pref_error(MACROBLOCKD *xd, const AV1_COMMON *cm,
   }
 #else
   DECLARE_ALIGNED(16, uint8_t, pred[MAX_SB_SQUARE]);
-  if (second_pred != NULL) {
+  if (get_cached_upsampled_pred(xd, cm, this_mv, var_params, pred)) {
+    if (second_pred != NULL) {
+      if (mask) {
+        aom_comp_mask_pred(pred, second_pred, w, h, pred, w, mask, mask_stride,
+                           invert_mask);
+      } else {
+        aom_comp_avg_pred(pred, second_pred, w, h, pred, w);
+      }
+    }
+  } else if (second_pred != NULL) {
     if (mask) {
       aom_comp_mask_upsampled_pred(xd, cm, mi_row, mi_col, this_mv, pred,
                                    second_pred, w, h, subpel_x_q3, subpel_y_q3,
@@ -286,6 +286,8 @@ typedef struct {
   // Source and reference buffers
   MSBuffers ms_buffers;
   int w, h;
+  // Upsampled reference cache, NULL when it is not in use.
+  const SubpelPlaneCache *plane_cache;
 } SUBPEL_SEARCH_VAR_PARAMS;
 
 // This struct holds subpixel motion search parameters that should be constant
@@ -310,6 +312,15 @@ void av1_make_default_subpel_ms_params(SUBPEL_MOTION_SEARCH_PARAMS *ms_params,
                                        const MACROBLOCK *x, BLOCK_SIZE bsize,
                                        const MV *ref_mv, const int *cost_list);
 
+// Drops all the tiles of the subpel plane cache and enables it for the
+// superblock about to be encoded. 'border' is the border of the reference
+// frames in pixels.
+void av1_subpel_plane_cache_start_sb(SubpelPlaneCache *cache, int border);
+
+static inline void av1_subpel_plane_cache_end_sb(SubpelPlaneCache *cache) {
+  cache->active = 0;
+}
+
 typedef int(fractional_mv_step_fp)(MACROBLOCKD *xd, const AV1_COMMON *const cm,
                                    const SUBPEL_MOTION_SEARCH_PARAMS *ms_params,
                                    MV start_mv,
@@ -22,6 +22,8 @@
 #define MAX_FULL_PEL_VAL ((1 << (MAX_MVSEARCH_STEPS - 1)) - 1)
 // Maximum size of the first step in full pel units
 #define MAX_FIRST_STEP (1 << (MAX_MVSEARCH_STEPS - 1))
+// Maximum number of candidates in one step of a search pattern.
+#define MAX_PATTERN_SITES 16
 // Maximum number of neighbors to scan per iteration during
 // WARPED_CAUSAL refinement
 // Note: The elements of warp_search_config.neighbor_mask must be at least
@@ -45,7 +47,7 @@ typedef struct search_site {
 } search_site;
 
 typedef struct search_site_config {
-  search_site site[MAX_MVSEARCH_STEPS * 2][16 + 1];
+  search_site site[MAX_MVSEARCH_STEPS * 2][MAX_PATTERN_SITES + 1];
   // Number of search steps.
   int num_search_steps;
   int searches_per_step[MAX_MVSEARCH_STEPS * 2];
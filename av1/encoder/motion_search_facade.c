@@ -9,6 +9,10 @@
  * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
  */
 
+#include "config/aom_dsp_rtcd.h"
+
+#include "aom_dsp/pyramid.h"
+
 #include "av1/common/reconinter.h"
 
 #include "av1/encoder/encodemv.h"
@@ -117,6 +121,179 @@ static inline void get_mv_candidate_from_tpl(const AV1_COMP *const cpi,
   }
 }
 
+#if !CONFIG_REALTIME_ONLY
+// Pyramid level on which the superblock motion field search starts.
+#define SB_MV_FIELD_TOP_LEVEL 2
+// Range of the exhaustive search on the top level, in pixels of that level.
+#define SB_MV_FIELD_TOP_RANGE 8
+// Range of the refinement on the lower levels, in pixels of that level.
+#define SB_MV_FIELD_REFINE_RANGE 2
+// Full-pel search window used around a motion field candidate.
+#define SB_MV_FIELD_SEARCH_RANGE 8
+// Size of the blocks matched on each pyramid level.
+#define SB_MV_FIELD_BLK_SIZE (1 << SB_MV_FIELD_UNIT_LOG2)
+
+// Finds the offset with the lowest SAD within +/-range of center for the
+// 16x16 block at (x, y) of the given pyramid layer.
+static FULLPEL_MV search_pyramid_block(const PyramidLayer *src,
+                                       const PyramidLayer *ref, int x, int y,
+                                       FULLPEL_MV center, int range) {
+  // Keep the source block inside the layer, and the reference block inside
+  // the padded layer.
+  x = AOMMIN(x, src->width - SB_MV_FIELD_BLK_SIZE);
+  y = AOMMIN(y, src->height - SB_MV_FIELD_BLK_SIZE);
+  const int min_row = AOMMAX(center.row - range, -PYRAMID_PADDING - y);
+  const int max_row =
+      AOMMIN(center.row + range,
+             ref->height + PYRAMID_PADDING - SB_MV_FIELD_BLK_SIZE - y);
+  const int min_col = AOMMAX(center.col - range, -PYRAMID_PADDING - x);
+  const int max_col =
+      AOMMIN(center.col + range,
+             ref->width + PYRAMID_PADDING - SB_MV_FIELD_BLK_SIZE - x);
+  const uint8_t *const src_buf = src->buffer + y * src->stride + x;
+
+  FULLPEL_MV best_mv = { clamp(center.row, min_row, max_row),
+                         clamp(center.col, min_col, max_col) };
+  const uint8_t *ref_buf =
+      ref->buffer + (y + best_mv.row) * ref->stride + x + best_mv.col;
+  unsigned int best_sad =
+      aom_sad16x16(src_buf, src->stride, ref_buf, ref->stride);
+  for (int row = min_row; row <= max_row; ++row) {
+    ref_buf = ref->buffer + (y + row) * ref->stride + x;
+    int col = min_col;
+    for (; col + 3 <= max_col; col += 4) {
+      const uint8_t *const ref_ptrs[4] = { ref_buf + col, ref_buf + col + 1,
+                                           ref_buf + col + 2,
+                                           ref_buf + col + 3 };
+      unsigned int sads[4];
+      aom_sad16x16x4d(src_buf, src->stride, ref_ptrs, ref->stride, sads);
+      for (int i = 0; i < 4; ++i) {
+        if (sads[i] < best_sad) {
+          best_sad = sads[i];
+          best_mv.row = row;
+          best_mv.col = col + i;
+        }
+      }
+    }
+    for (; col <= max_col; ++col) {
+      const unsigned int sad =
+          aom_sad16x16(src_buf, src->stride, ref_buf + col, ref->stride);
+      if (sad < best_sad) {
+        best_sad = sad;
+        best_mv.row = row;
+        best_mv.col = col;
+      }
+    }
+  }
+  return best_mv;
+}
+
+// Computes the motion field of the current superblock against the given
+// reference: an exhaustive search around the zero MV on the top pyramid
+// level, refined level by level down to one MV per 16x16 unit at full
+// resolution. Returns 0 if the pyramids are not usable for this reference.
+static int compute_sb_mv_field(const AV1_COMP *const cpi,
+                               const MACROBLOCK *x, int ref,
+                               FULLPEL_MV *mv_field) {
+  const AV1_COMMON *const cm = &cpi->common;
+  const YV12_BUFFER_CONFIG *const src = cpi->source;
+  const YV12_BUFFER_CONFIG *const ref_buf = get_ref_frame_yv12_buf(cm, ref);
+  if (ref_buf == NULL || src->y_pyramid == NULL ||
+      ref_buf->y_pyramid == NULL ||
+      src->y_crop_width != ref_buf->y_crop_width ||
+      src->y_crop_height != ref_buf->y_crop_height)
+    return 0;
+
+  const int bit_depth = cm->seq_params->bit_depth;
+  const int num_levels = SB_MV_FIELD_TOP_LEVEL + 1;
+  if (aom_compute_pyramid(src, bit_depth, num_levels, src->y_pyramid) <
+          num_levels ||
+      aom_compute_pyramid(ref_buf, bit_depth, num_levels,
+                          ref_buf->y_pyramid) < num_levels)
+    return 0;
+  const PyramidLayer *const top_layer =
+      &src->y_pyramid->layers[SB_MV_FIELD_TOP_LEVEL];
+  if (top_layer->width < SB_MV_FIELD_BLK_SIZE ||
+      top_layer->height < SB_MV_FIELD_BLK_SIZE)
+    return 0;
+
+  const MACROBLOCKD *const xd = &x->e_mbd;
+  const int sb_mi_size = cm->seq_params->mib_size;
+  const int sb_x = (xd->mi_col & ~(sb_mi_size - 1)) * MI_SIZE;
+  const int sb_y = (xd->mi_row & ~(sb_mi_size - 1)) * MI_SIZE;
+  const int sb_units = (sb_mi_size * MI_SIZE) >> SB_MV_FIELD_UNIT_LOG2;
+
+  // Each level stores its MVs at the top-left unit of every block it matches.
+  FULLPEL_MV level_mvs[MAX_SB_MV_FIELD_UNITS * MAX_SB_MV_FIELD_UNITS];
+  for (int level = SB_MV_FIELD_TOP_LEVEL; level >= 0; --level) {
+    const PyramidLayer *const src_layer = &src->y_pyramid->layers[level];
+    const PyramidLayer *const ref_layer = &ref_buf->y_pyramid->layers[level];
+    const int step = 1 << level;
+    const int parent_mask = ~(2 * step - 1);
+    for (int row = 0; row < sb_units; row += step) {
+      for (int col = 0; col < sb_units; col += step) {
+        const int blk_x = (sb_x + (col << SB_MV_FIELD_UNIT_LOG2)) >> level;
+        const int blk_y = (sb_y + (row << SB_MV_FIELD_UNIT_LOG2)) >> level;
+        FULLPEL_MV center = kZeroFullMv;
+        int range = SB_MV_FIELD_TOP_RANGE;
+        if (level < SB_MV_FIELD_TOP_LEVEL) {
+          const FULLPEL_MV parent_mv =
+              mv_field[(row & parent_mask) * sb_units + (col & parent_mask)];
+          center.row = 2 * parent_mv.row;
+          center.col = 2 * parent_mv.col;
+          range = SB_MV_FIELD_REFINE_RANGE;
+        }
+        // Units outside of the frame inherit the MV of their parent.
+        level_mvs[row * sb_units + col] =
+            (blk_x < src_layer->width && blk_y < src_layer->height)
+                ? search_pyramid_block(src_layer, ref_layer, blk_x, blk_y,
+                                       center, range)
+                : center;
+      }
+    }
+    memcpy(mv_field, level_mvs, sizeof(level_mvs));
+  }
+  return 1;
+}
+
+// Adds the superblock motion field MV at the center of the current block to
+// the start MV candidates. Returns the index of the new candidate, or -1.
+static inline int get_mv_candidate_from_mv_field(const AV1_COMP *const cpi,
+                                                 MACROBLOCK *x,
+                                                 BLOCK_SIZE bsize, int ref,
+                                                 cand_mv_t *cand,
+                                                 int *cand_count) {
+  SuperBlockEnc *const sb_enc = &x->sb_enc;
+  const int ref_idx = ref - LAST_FRAME;
+  if (sb_enc->mv_field_state[ref_idx] == SB_MV_FIELD_PENDING) {
+    sb_enc->mv_field_state[ref_idx] =
+        compute_sb_mv_field(cpi, x, ref, sb_enc->mv_field[ref_idx])
+            ? SB_MV_FIELD_VALID
+            : SB_MV_FIELD_UNAVAILABLE;
+  }
+  if (sb_enc->mv_field_state[ref_idx] != SB_MV_FIELD_VALID) return -1;
+
+  const MACROBLOCKD *const xd = &x->e_mbd;
+  const int sb_mi_size = cpi->common.seq_params->mib_size;
+  const int sb_units = (sb_mi_size * MI_SIZE) >> SB_MV_FIELD_UNIT_LOG2;
+  const int center_x = (xd->mi_col & (sb_mi_size - 1)) * MI_SIZE +
+                       (block_size_wide[bsize] >> 1);
+  const int center_y = (xd->mi_row & (sb_mi_size - 1)) * MI_SIZE +
+                       (block_size_high[bsize] >> 1);
+  const FULLPEL_MV fmv =
+      sb_enc->mv_field[ref_idx][(center_y >> SB_MV_FIELD_UNIT_LOG2) * sb_units +
+                                (center_x >> SB_MV_FIELD_UNIT_LOG2)];
+  for (int m = 0; m < *cand_count; m++) {
+    if (fmv.row == cand[m].fmv.as_fullmv.row &&
+        fmv.col == cand[m].fmv.as_fullmv.col)
+      return -1;
+  }
+  cand[*cand_count].fmv.as_fullmv = fmv;
+  cand[*cand_count].weight = 0;
+  return (*cand_count)++;
+}
+#endif  // !CONFIG_REALTIME_ONLY
+
 void av1_single_motion_search(const AV1_COMP *const cpi, MACROBLOCK *x,
                               BLOCK_SIZE bsize, int ref_idx, int *rate_mv,
                               int search_range, inter_mode_info *mode_info,
@@ -181,6 +358,15 @@ void av1_single_motion_search(const AV1_COMP *const cpi, MACROBLOCK *x,
     get_mv_candidate_from_tpl(cpi, x, bsize, ref, cand, &cnt, &total_weight);
   }
 
+  int mv_field_cand_idx = -1;
+#if !CONFIG_REALTIME_ONLY
+  if (cpi->sf.mv_sf.use_sb_mv_field && cnt == 1 && !scaled_ref_frame &&
+      mbmi->motion_mode == SIMPLE_TRANSLATION) {
+    mv_field_cand_idx =
+        get_mv_candidate_from_mv_field(cpi, x, bsize, ref, cand, &cnt);
+  }
+#endif  // !CONFIG_REALTIME_ONLY
+
   const int cand_cnt = AOMMIN(2, cnt);
   // TODO(any): Test the speed feature for OBMC_CAUSAL mode.
   if (cpi->sf.mv_sf.skip_fullpel_search_using_startmv &&
@@ -245,10 +431,11 @@ void av1_single_motion_search(const AV1_COMP *const cpi, MACROBLOCK *x,
   const search_site_config *src_search_site_cfg =
       av1_get_search_site_config(cpi, x, search_method);
 
+  const search_site_config *search_site_cfg =
+      &src_search_site_cfg[search_method_lookup[search_method]];
+
   // Further reduce the search range.
   if (search_range < INT_MAX) {
-    const search_site_config *search_site_cfg =
-        &src_search_site_cfg[search_method_lookup[search_method]];
     // Max step_param is search_site_cfg->num_search_steps.
     if (search_range < 1) {
       step_param = search_site_cfg->num_search_steps;
@@ -260,6 +447,17 @@ void av1_single_motion_search(const AV1_COMP *const cpi, MACROBLOCK *x,
     }
   }
 
+  // The motion field MV is already close to the local motion, so it only
+  // needs a small search window.
+  int mv_field_step_param = step_param;
+  if (mv_field_cand_idx >= 0) {
+    while (search_site_cfg->num_search_steps - mv_field_step_param - 1 > 0 &&
+           search_site_cfg->radius[search_site_cfg->num_search_steps -
+                                   mv_field_step_param - 1] >
+               SB_MV_FIELD_SEARCH_RANGE)
+      mv_field_step_param++;
+  }
+
   int cost_list[5];
   FULLPEL_MV_STATS best_mv_stats;
   int_mv second_best_mv;
@@ -280,14 +478,19 @@ void av1_single_motion_search(const AV1_COMP *const cpi, MACROBLOCK *x,
 
         if (smv.as_int == INVALID_MV) continue;
 
+        const int use_mv_field_step_param =
+            mv_field_cand_idx >= 0 &&
+            (m == mv_field_cand_idx || cpi->sf.mv_sf.use_sb_mv_field >= 2);
+
         av1_make_default_fullpel_ms_params(
             &full_ms_params, cpi, x, bsize, &ref_mv, smv.as_fullmv,
             src_search_site_cfg, search_method, fine_search_interval);
 
-        const int thissme =
-            av1_full_pixel_search(smv.as_fullmv, &full_ms_params, step_param,
-                                  cond_cost_list(cpi, cost_list), &this_best_mv,
-                                  &this_mv_stats, &this_second_best_mv);
+        const int thissme = av1_full_pixel_search(
+            smv.as_fullmv, &full_ms_params,
+            use_mv_field_step_param ? mv_field_step_param : step_param,
+            cond_cost_list(cpi, cost_list), &this_best_mv, &this_mv_stats,
+            &this_second_best_mv);
 
         if (thissme < bestsme) {
           bestsme = thissme;
@@ -37,24 +37,22 @@ static const SCAN_ORDER av1_fast_idtx_scan_order_16x16 = {
   int16_t *const low_dqcoeff = (int16_t *)dqcoeff_buf;                    \
   const int diff_stride = bw;
 
-#define DECLARE_LOOP_VARS_BLOCK_YRD() \
-  const int16_t *src_diff = &p->src_diff[(r * diff_stride + c) << 2];
+#define DECLARE_LOOP_VARS_BLOCK_YRD()                                  \
+  const int16_t *src_diff = &p->src_diff[(r * diff_stride + c) << 2]; \
+  int64_t lp_error = 0;                                               \
+  int lp_abs_sum = 0;
 
+// qcoeff_abs_sum and error are the sum of absolute quantized coefficients and
+// the transform domain distortion, as returned by av1_quantize_lp_dist().
 static AOM_FORCE_INLINE void update_yrd_loop_vars(
-    MACROBLOCK *x, int *skippable, int step, int ncoeffs,
-    int16_t *const low_coeff, int16_t *const low_qcoeff,
-    int16_t *const low_dqcoeff, RD_STATS *this_rdc, int *eob_cost,
-    int tx_blk_id) {
+    MACROBLOCK *x, int *skippable, int ncoeffs, int qcoeff_abs_sum,
+    int64_t error, RD_STATS *this_rdc, int *eob_cost, int tx_blk_id) {
   const int is_txfm_skip = (ncoeffs == 0);
   *skippable &= is_txfm_skip;
   x->txfm_search_info.blk_skip[tx_blk_id] = is_txfm_skip;
   *eob_cost += get_msb(ncoeffs + 1);
-  if (ncoeffs == 1)
-    this_rdc->rate += (int)abs(low_qcoeff[0]);
-  else if (ncoeffs > 1)
-    this_rdc->rate += aom_satd_lp(low_qcoeff, step << 4);
-
-  this_rdc->dist += av1_block_error_lp(low_coeff, low_dqcoeff, step << 4) >> 2;
+  this_rdc->rate += qcoeff_abs_sum;
+  this_rdc->dist += error >> 2;
 }
 
 static inline void aom_process_hadamard_lp_8x16(MACROBLOCK *x,
@@ -212,14 +210,14 @@ void av1_block_yrd(MACROBLOCK *x, RD_STATS *this_rdc, int *skippable,
                             av1_default_iscan_fp_16x16_transpose);
           } else {
             aom_hadamard_lp_16x16(src_diff, diff_stride, low_coeff);
-            av1_quantize_lp(low_coeff, 16 * 16, p->round_fp_QTX,
-                            p->quant_fp_QTX, low_qcoeff, low_dqcoeff,
-                            p->dequant_QTX, eob,
-                            // default_scan_lp_16x16_transpose and
-                            // av1_default_iscan_lp_16x16_transpose have to be
-                            // used together.
-                            default_scan_lp_16x16_transpose,
-                            av1_default_iscan_lp_16x16_transpose);
+            lp_error = av1_quantize_lp_dist(
+                low_coeff, 16 * 16, p->round_fp_QTX, p->quant_fp_QTX,
+                low_qcoeff, low_dqcoeff, p->dequant_QTX, eob,
+                // default_scan_lp_16x16_transpose and
+                // av1_default_iscan_lp_16x16_transpose have to be used
+                // together.
+                default_scan_lp_16x16_transpose,
+                av1_default_iscan_lp_16x16_transpose, &lp_abs_sum);
           }
           break;
         case TX_8X8:
@@ -238,12 +236,13 @@ void av1_block_yrd(MACROBLOCK *x, RD_STATS *this_rdc, int *skippable,
             } else {
               aom_hadamard_lp_8x8(src_diff, diff_stride, low_coeff);
             }
-            av1_quantize_lp(
+            lp_error = av1_quantize_lp_dist(
                 low_coeff, 8 * 8, p->round_fp_QTX, p->quant_fp_QTX, low_qcoeff,
                 low_dqcoeff, p->dequant_QTX, eob,
                 // default_scan_8x8_transpose and
                 // av1_default_iscan_8x8_transpose have to be used together.
-                default_scan_8x8_transpose, av1_default_iscan_8x8_transpose);
+                default_scan_8x8_transpose, av1_default_iscan_8x8_transpose,
+                &lp_abs_sum);
           }
           break;
         default:
@@ -259,18 +258,19 @@ void av1_block_yrd(MACROBLOCK *x, RD_STATS *this_rdc, int *skippable,
                             scan_order->iscan);
           } else {
             aom_fdct4x4_lp(src_diff, low_coeff, diff_stride);
-            av1_quantize_lp(low_coeff, 4 * 4, p->round_fp_QTX, p->quant_fp_QTX,
-                            low_qcoeff, low_dqcoeff, p->dequant_QTX, eob,
-                            scan_order->scan, scan_order->iscan);
+            lp_error = av1_quantize_lp_dist(
+                low_coeff, 4 * 4, p->round_fp_QTX, p->quant_fp_QTX, low_qcoeff,
+                low_dqcoeff, p->dequant_QTX, eob, scan_order->scan,
+                scan_order->iscan, &lp_abs_sum);
           }
           break;
 #else
         case TX_16X16:
           aom_hadamard_lp_16x16(src_diff, diff_stride, low_coeff);
-          av1_quantize_lp(low_coeff, 16 * 16, p->round_fp_QTX, p->quant_fp_QTX,
-                          low_qcoeff, low_dqcoeff, p->dequant_QTX, eob,
-                          default_scan_lp_16x16_transpose,
-                          av1_default_iscan_lp_16x16_transpose);
+          lp_error = av1_quantize_lp_dist(
+              low_coeff, 16 * 16, p->round_fp_QTX, p->quant_fp_QTX, low_qcoeff,
+              low_dqcoeff, p->dequant_QTX, eob, default_scan_lp_16x16_transpose,
+              av1_default_iscan_lp_16x16_transpose, &lp_abs_sum);
           break;
         case TX_8X8:
           if (is_tx_8x8_dual_applicable) {
@@ -281,16 +281,17 @@ void av1_block_yrd(MACROBLOCK *x, RD_STATS *this_rdc, int *skippable,
           } else {
             aom_hadamard_lp_8x8(src_diff, diff_stride, low_coeff);
           }
-          av1_quantize_lp(low_coeff, 8 * 8, p->round_fp_QTX, p->quant_fp_QTX,
-                          low_qcoeff, low_dqcoeff, p->dequant_QTX, eob,
-                          default_scan_8x8_transpose,
-                          av1_default_iscan_8x8_transpose);
+          lp_error = av1_quantize_lp_dist(
+              low_coeff, 8 * 8, p->round_fp_QTX, p->quant_fp_QTX, low_qcoeff,
+              low_dqcoeff, p->dequant_QTX, eob, default_scan_8x8_transpose,
+              av1_default_iscan_8x8_transpose, &lp_abs_sum);
           break;
         default:
           aom_fdct4x4_lp(src_diff, low_coeff, diff_stride);
-          av1_quantize_lp(low_coeff, 4 * 4, p->round_fp_QTX, p->quant_fp_QTX,
-                          low_qcoeff, low_dqcoeff, p->dequant_QTX, eob,
-                          scan_order->scan, scan_order->iscan);
+          lp_error = av1_quantize_lp_dist(
+              low_coeff, 4 * 4, p->round_fp_QTX, p->quant_fp_QTX, low_qcoeff,
+              low_dqcoeff, p->dequant_QTX, eob, scan_order->scan,
+              scan_order->iscan, &lp_abs_sum);
           break;
 #endif
       }
@@ -302,9 +303,8 @@ void av1_block_yrd(MACROBLOCK *x, RD_STATS *this_rdc, int *skippable,
                                  r * num_blk_skip_w + c);
       else
 #endif
-        update_yrd_loop_vars(x, &temp_skippable, step, *eob, low_coeff,
-                             low_qcoeff, low_dqcoeff, this_rdc, &eob_cost,
-                             r * num_blk_skip_w + c);
+        update_yrd_loop_vars(x, &temp_skippable, *eob, lp_abs_sum, lp_error,
+                             this_rdc, &eob_cost, r * num_blk_skip_w + c);
     }
     block += row_step;
   }
@@ -436,13 +436,13 @@ void av1_block_yrd_idtx(MACROBLOCK *x, const uint8_t *const pred_buf,
     for (int c = 0, s = 0; c < max_blocks_wide; c += block_step, s += step) {
       DECLARE_LOOP_VARS_BLOCK_YRD()
       scale_square_buf_vals(low_coeff, tx_wd, src_diff, diff_stride);
-      av1_quantize_lp(low_coeff, tx_wd * tx_wd, p->round_fp_QTX,
-                      p->quant_fp_QTX, low_qcoeff, low_dqcoeff, p->dequant_QTX,
-                      eob, scan_order->scan, scan_order->iscan);
+      lp_error = av1_quantize_lp_dist(
+          low_coeff, tx_wd * tx_wd, p->round_fp_QTX, p->quant_fp_QTX,
+          low_qcoeff, low_dqcoeff, p->dequant_QTX, eob, scan_order->scan,
+          scan_order->iscan, &lp_abs_sum);
       assert(*eob <= 1024);
-      update_yrd_loop_vars(x, &temp_skippable, step, *eob, low_coeff,
-                           low_qcoeff, low_dqcoeff, this_rdc, &eob_cost,
-                           r * num_blk_skip_w + c);
+      update_yrd_loop_vars(x, &temp_skippable, *eob, lp_abs_sum, lp_error,
+                           this_rdc, &eob_cost, r * num_blk_skip_w + c);
     }
   }
   this_rdc->skip_txfm = *skippable = temp_skippable;
@@ -33,25 +33,26 @@ static inline int early_term_inter_search_with_sse(int early_term_idx,
                                                    int64_t best_sse,
                                                    PREDICTION_MODE this_mode) {
   // Aggressiveness to terminate inter mode search early is adjusted based on
-  // speed and block size.
-  static const double early_term_thresh[4][4] = { { 0.65, 0.65, 0.65, 0.7 },
-                                                  { 0.6, 0.65, 0.85, 0.9 },
-                                                  { 0.5, 0.5, 0.55, 0.6 },
-                                                  { 0.6, 0.75, 0.85, 0.85 } };
-  static const double early_term_thresh_newmv_nearestmv[4] = { 0.3, 0.3, 0.3,
-                                                               0.3 };
+  // speed and block size. The thresholds are in percent.
+  static const int early_term_thresh[4][4] = { { 65, 65, 65, 70 },
+                                               { 60, 65, 85, 90 },
+                                               { 50, 50, 55, 60 },
+                                               { 60, 75, 85, 85 } };
+  static const int early_term_thresh_newmv_nearestmv[4] = { 30, 30, 30, 30 };
 
   const int size_group = size_group_lookup[bsize];
   assert(size_group < 4);
   assert((early_term_idx > 0) && (early_term_idx < EARLY_TERM_INDICES));
-  const double threshold =
+  const int threshold =
       ((early_term_idx == EARLY_TERM_IDX_4) &&
        (this_mode == NEWMV || this_mode == NEARESTMV))
           ? early_term_thresh_newmv_nearestmv[size_group]
           : early_term_thresh[early_term_idx - 1][size_group];
 
-  // Terminate inter mode search early based on best sse so far.
-  if ((early_term_idx > 0) && (threshold * this_sse > best_sse)) {
+  // Terminate inter mode search early based on best sse so far. best_sse is
+  // INT64_MAX until a mode has been evaluated.
+  if ((early_term_idx > 0) && best_sse <= INT64_MAX / 100 &&
+      (threshold * this_sse > 100 * best_sse)) {
     return 1;
   }
   return 0;
@@ -2249,12 +2250,14 @@ static inline bool previous_mode_performed_poorly(
     best_uv_dist = AOMMIN(best_uv_dist, uv_dist[midx][ref_frame]);
   }
   assert(best_var != UINT_MAX && "Invalid variance data.");
-  const float mult = 1.125f;
-  bool var_bad = mult * best_var < vars[INTER_OFFSET(mode)][ref_frame];
+  // The mode is bad if it is 1.125 times worse than the best one.
+  bool var_bad =
+      9 * (int64_t)best_var < 8 * (int64_t)vars[INTER_OFFSET(mode)][ref_frame];
   if (uv_dist[INTER_OFFSET(mode)][ref_frame] < INT64_MAX &&
       best_uv_dist != uv_dist[INTER_OFFSET(mode)][ref_frame]) {
     // If we have chroma info, then take it into account
-    var_bad &= mult * best_uv_dist < uv_dist[INTER_OFFSET(mode)][ref_frame];
+    var_bad &= best_uv_dist + (best_uv_dist >> 3) <
+               uv_dist[INTER_OFFSET(mode)][ref_frame];
   }
   return var_bad;
 }
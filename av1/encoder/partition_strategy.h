@@ -228,6 +228,12 @@ static inline void set_max_min_partition_size(SuperBlockEnc *sb_enc,
       AOMMIN(sb_enc->max_partition_size, cm->seq_params->sb_size);
   sb_enc->min_partition_size =
       AOMMIN(sb_enc->min_partition_size, cm->seq_params->sb_size);
+  // Low effort region of interest superblocks are not split below 16x16.
+  if (x->roi_low_effort_sb) {
+    sb_enc->min_partition_size =
+        AOMMIN(AOMMAX(sb_enc->min_partition_size, BLOCK_16X16),
+               sb_enc->max_partition_size);
+  }
 
   if (use_auto_max_partition(cpi, sb_size, mi_row, mi_col)) {
     float features[FEATURE_SIZE_MAX_MIN_PART_PRED] = { 0.0f };
@@ -363,42 +363,33 @@ static const int rd_layer_depth_factor[7] = {
   160, 160, 160, 160, 192, 208, 224
 };
 
-// Returns the default rd multiplier for inter frames for a given qindex.
-// The function here is a first pass estimate based on data from
-// a previous Vizer run
-static double def_inter_rd_multiplier(int qindex) {
-  return 3.2 + (0.0015 * (double)qindex);
-}
-
-// Returns the default rd multiplier for ARF/Golden Frames for a given qindex.
-// The function here is a first pass estimate based on data from
-// a previous Vizer run
-static double def_arf_rd_multiplier(int qindex) {
-  return 3.25 + (0.0015 * (double)qindex);
-}
-
-// Returns the default rd multiplier for key frames for a given qindex.
-// The function here is a first pass estimate based on data from
-// a previous Vizer run
-static double def_kf_rd_multiplier(int qindex) {
-  return 3.3 + (0.0015 * (double)qindex);
+#define RD_MULT_SCALE 10000
+#define RD_MULT_SLOPE 15
+
+// Returns the default rd multiplier for a given quantizer, in units of
+// 1 / RD_MULT_SCALE. The multiplier is linear in q, e.g. 3.2 + 0.0015 * q for
+// inter frames, as a first pass estimate based on data from a previous Vizer
+// run. It is kept in integers so the rd multiplier is bit-exact across
+// platforms; the floating point form may be contracted into a fused
+// multiply-add by some compilers.
+static int64_t def_rd_multiplier(FRAME_UPDATE_TYPE update_type, int q) {
+  int64_t offset;
+  if (update_type == KF_UPDATE) {
+    offset = 33000;
+  } else if ((update_type == GF_UPDATE) || (update_type == ARF_UPDATE)) {
+    offset = 32500;
+  } else {
+    offset = 32000;
+  }
+  return offset + RD_MULT_SLOPE * (int64_t)q;
 }
 
 int av1_compute_rd_mult_based_on_qindex(aom_bit_depth_t bit_depth,
                                         FRAME_UPDATE_TYPE update_type,
                                         int qindex) {
   const int q = av1_dc_quant_QTX(qindex, 0, bit_depth);
-  int64_t rdmult = q * q;
-  if (update_type == KF_UPDATE) {
-    double def_rd_q_mult = def_kf_rd_multiplier(q);
-    rdmult = (int64_t)((double)rdmult * def_rd_q_mult);
-  } else if ((update_type == GF_UPDATE) || (update_type == ARF_UPDATE)) {
-    double def_rd_q_mult = def_arf_rd_multiplier(q);
-    rdmult = (int64_t)((double)rdmult * def_rd_q_mult);
-  } else {
-    double def_rd_q_mult = def_inter_rd_multiplier(q);
-    rdmult = (int64_t)((double)rdmult * def_rd_q_mult);
-  }
+  int64_t rdmult =
+      (int64_t)q * q * def_rd_multiplier(update_type, q) / RD_MULT_SCALE;
 
   switch (bit_depth) {
     case AOM_BITS_8: break;
@@ -1057,6 +1048,27 @@ void av1_model_rd_curvfit(BLOCK_SIZE bsize, double sse_norm, double xqr,
   *distbysse_f = interp_cubic(pdist, xo);
 }
 
+// Models the per pixel rate and distortion of a residual block given its mean
+// squared value (sse_norm) and the mean absolute value of its orthonormal
+// Hadamard coefficients (satd_norm). The coefficients are treated as Laplacian
+// with the measured mean, whose variance 2 * satd_norm^2 falls below sse_norm
+// when the energy is compacted into a few coefficients. That variance is then
+// fed to the curve fit model above in place of sse_norm.
+void av1_model_rd_satd_curvfit(BLOCK_SIZE bsize, double sse_norm,
+                               double satd_norm, double qstep, double *rate_f,
+                               double *dist_f) {
+  const double var = AOMMIN(sse_norm, 2.0 * satd_norm * satd_norm);
+  if (var <= 0.0) {
+    *rate_f = 0.0;
+    *dist_f = 0.0;
+    return;
+  }
+  double distbyvar_f;
+  av1_model_rd_curvfit(bsize, var, log2(var / (qstep * qstep)), rate_f,
+                       &distbyvar_f);
+  *dist_f = distbyvar_f * var;
+}
+
 static void get_entropy_contexts_plane(BLOCK_SIZE plane_bsize,
                                        const struct macroblockd_plane *pd,
                                        ENTROPY_CONTEXT t_above[MAX_MIB_SIZE],
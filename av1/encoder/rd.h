@@ -258,6 +258,10 @@ void av1_model_rd_from_var_lapndz(int64_t var, unsigned int n,
 void av1_model_rd_curvfit(BLOCK_SIZE bsize, double sse_norm, double xqr,
                           double *rate_f, double *distbysse_f);
 
+void av1_model_rd_satd_curvfit(BLOCK_SIZE bsize, double sse_norm,
+                               double satd_norm, double qstep, double *rate_f,
+                               double *dist_f);
+
 int av1_get_switchable_rate(const MACROBLOCK *x, const MACROBLOCKD *xd,
                             InterpFilter interp_filter, int dual_filter);
 
@@ -1306,6 +1306,14 @@ static int64_t motion_mode_rd(
     // warped parameters.
     last_motion_mode_allowed = OBMC_CAUSAL;
   }
+  // The decode cost of OBMC and local warped motion is mostly per block, so it
+  // is highest relative to area in small blocks. Avoid them there when tuning
+  // for decode speed. This must follow the collection of projection samples,
+  // which the bitstream depends on.
+  if (cpi->oxcf.tune_cfg.target_decoder_threads &&
+      AOMMIN(block_size_wide[bsize], block_size_high[bsize]) < 16) {
+    last_motion_mode_allowed = SIMPLE_TRANSLATION;
+  }
 
   const MB_MODE_INFO base_mbmi = *mbmi;
   MB_MODE_INFO best_mbmi;
@@ -6285,7 +6293,8 @@ void av1_rd_pick_inter_mode_sb_seg_skip(const AV1_COMP *cpi,
 
   rd_cost->rate = INT_MAX;
 
-  assert(segfeature_active(&cm->seg, segment_id, SEG_LVL_SKIP));
+  assert(segfeature_active(&cm->seg, segment_id, SEG_LVL_SKIP) ||
+         x->static_sb_skip);
 
   mbmi->palette_mode_info.palette_size[0] = 0;
   mbmi->palette_mode_info.palette_size[1] = 0;
@@ -6352,13 +6361,28 @@ void av1_rd_pick_inter_mode_sb_seg_skip(const AV1_COMP *cpi,
   // Estimate the reference frame signaling cost and add it
   // to the rolling cost variable.
   rate2 += ref_costs_single[LAST_FRAME];
+
+  if (x->static_sb_skip) {
+    // Unlike a skip segment, the mode and the skip flag are signaled. The mode
+    // context is also needed by the bitstream writer.
+    MB_MODE_INFO_EXT *const mbmi_ext = &x->mbmi_ext;
+    av1_find_mv_refs(cm, xd, mbmi, LAST_FRAME, mbmi_ext->ref_mv_count,
+                     xd->ref_mv_stack, xd->weight, NULL, mbmi_ext->global_mvs,
+                     mbmi_ext->mode_context);
+    av1_copy_usable_ref_mv_stack_and_weight(xd, mbmi_ext, LAST_FRAME);
+    const int16_t mode_ctx =
+        av1_mode_context_analyzer(mbmi_ext->mode_context, mbmi->ref_frame);
+    rate2 += cost_mv_ref(mode_costs, GLOBALMV, mode_ctx);
+    rate2 += mode_costs->skip_txfm_cost[av1_get_skip_txfm_context(xd)][1];
+    mbmi->skip_txfm = 1;
+  }
   this_rd = RDCOST(x->rdmult, rate2, distortion2);
 
   rd_cost->rate = rate2;
   rd_cost->dist = distortion2;
   rd_cost->rdcost = this_rd;
 
-  if (this_rd >= best_rd_so_far) {
+  if (this_rd >= best_rd_so_far && !x->static_sb_skip) {
     rd_cost->rate = INT_MAX;
     rd_cost->rdcost = INT64_MAX;
     return;
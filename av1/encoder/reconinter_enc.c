@@ -16,6 +16,7 @@
 #include "config/aom_config.h"
 #include "config/aom_dsp_rtcd.h"
 #include "config/aom_scale_rtcd.h"
+#include "config/av1_rtcd.h"
 
 #include "aom/aom_integer.h"
 #include "aom_dsp/blend.h"
@@ -81,6 +82,59 @@ void av1_enc_build_inter_predictor_y(MACROBLOCKD *xd, int mi_row, int mi_col) {
                                     &inter_pred_params);
 }
 
+int av1_enc_build_inter_predictor_y_cached(MACROBLOCKD *xd, int mi_row,
+                                           int mi_col,
+                                           InterpPredCache *cache) {
+  const MB_MODE_INFO *mi = xd->mi[0];
+  if (cache->im_block[0] == NULL || has_second_ref(mi) ||
+      is_intrabc_block(mi) || is_interintra_pred(mi) || is_cur_buf_hbd(xd))
+    return 0;
+  const InterpFilter x_filter = mi->interp_filters.as_filters.x_filter;
+  if (x_filter >= SWITCHABLE_FILTERS) return 0;
+  const struct scale_factors *const sf = xd->block_ref_scale_factors[0];
+  if (av1_is_scaled(sf)) return 0;
+
+  struct macroblockd_plane *const pd = &xd->plane[AOM_PLANE_Y];
+  const WarpedMotionParams *const wm = &xd->global_motion[mi->ref_frame[0]];
+  const WarpTypesAllowed warp_types = { is_global_mv_block(mi, wm->wmtype),
+                                        mi->motion_mode == WARPED_CAUSAL };
+  InterPredParams inter_pred_params;
+  av1_init_inter_params(&inter_pred_params, pd->width, pd->height,
+                        mi_row * MI_SIZE, mi_col * MI_SIZE, 0, 0, xd->bd,
+                        false, false, sf, &pd->pre[0], mi->interp_filters);
+  inter_pred_params.conv_params = get_conv_params_no_round(
+      0, AOM_PLANE_Y, xd->tmp_conv_dst, MAX_SB_SIZE, false, xd->bd);
+  av1_init_warp_params(&inter_pred_params, &warp_types, 0, xd, mi);
+  if (inter_pred_params.mode != TRANSLATION_PRED) return 0;
+
+  const InterpFilterParams *const filter_x =
+      inter_pred_params.interp_filter_params[0];
+  const InterpFilterParams *const filter_y =
+      inter_pred_params.interp_filter_params[1];
+  if (filter_x->taps != SUBPEL_TAPS || filter_y->taps != SUBPEL_TAPS) return 0;
+
+  SubpelParams subpel_params;
+  uint8_t *src;
+  int src_stride;
+  enc_calc_subpel_params(&mi->mv[0].as_mv, &inter_pred_params, &src,
+                         &subpel_params, &src_stride);
+  revert_scale_extra_bits(&subpel_params);
+  // Only the 2D case has a horizontal pass worth sharing.
+  if (subpel_params.subpel_x == 0 || subpel_params.subpel_y == 0) return 0;
+
+  int16_t *const im_block = cache->im_block[x_filter];
+  if (!(cache->valid_mask & (1 << x_filter))) {
+    av1_convolve_2d_sr_horiz(src, src_stride, im_block, pd->width, pd->height,
+                             filter_x, subpel_params.subpel_x,
+                             &inter_pred_params.conv_params);
+    cache->valid_mask |= 1 << x_filter;
+  }
+  av1_convolve_2d_sr_vert(im_block, pd->dst.buf, pd->dst.stride, pd->width,
+                          pd->height, filter_y, subpel_params.subpel_y,
+                          &inter_pred_params.conv_params);
+  return 1;
+}
+
 void av1_enc_build_inter_predictor_y_nonrd(MACROBLOCKD *xd,
                                            InterPredParams *inter_pred_params,
                                            const SubpelParams *subpel_params) {
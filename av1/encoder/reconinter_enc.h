@@ -19,6 +19,7 @@
 #include "av1/common/filter.h"
 #include "av1/common/reconinter.h"
 #include "av1/common/warped_motion.h"
+#include "av1/encoder/block.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -49,6 +50,14 @@ void av1_enc_build_inter_predictor(const AV1_COMMON *cm, MACROBLOCKD *xd,
 
 void av1_enc_build_inter_predictor_y(MACROBLOCKD *xd, int mi_row, int mi_col);
 
+// Builds the single reference luma predictor of a 2D subpel translational
+// block, reusing the horizontal pass stored in |cache| for the block's x
+// filter when available. The result is bit-exact with
+// av1_enc_build_inter_predictor(). Returns 0 without building anything if the
+// block does not qualify, in which case the caller must use the regular path.
+int av1_enc_build_inter_predictor_y_cached(MACROBLOCKD *xd, int mi_row,
+                                           int mi_col, InterpPredCache *cache);
+
 void av1_enc_build_inter_predictor_y_nonrd(MACROBLOCKD *xd,
                                            InterPredParams *inter_pred_params,
                                            const SubpelParams *subpel_params);
@@ -799,6 +799,8 @@ static void set_good_speed_feature_framesize_dependent(
       sf->mv_sf.skip_fullpel_search_using_startmv = boosted ? 0 : 1;
     }
 
+    sf->mv_sf.use_sb_mv_field = boosted ? 1 : 2;
+
     sf->inter_sf.disable_interinter_wedge_var_thresh = UINT_MAX;
     sf->inter_sf.prune_obmc_prob_thresh = INT_MAX;
     sf->inter_sf.limit_txfm_eval_per_mode = boosted ? 0 : 2;
@@ -996,6 +998,7 @@ static void set_good_speed_features_framesize_independent(
     // speed feature accordingly
     sf->part_sf.simple_motion_search_split = allow_screen_content_tools ? 1 : 2;
     sf->part_sf.ml_predict_breakout_level = use_hbd ? 2 : 3;
+    sf->part_sf.static_sb_skip = 1;
 
     sf->mv_sf.exhaustive_searches_thresh <<= 1;
     sf->mv_sf.obmc_full_pixel_search_level = 1;
@@ -1040,6 +1043,7 @@ static void set_good_speed_features_framesize_independent(
 
   if (speed >= 2) {
     sf->hl_sf.recode_loop = ALLOW_RECODE_KFARFGF;
+    sf->hl_sf.adaptive_tf_frames = 1;
 
     sf->fp_sf.skip_motion_search_threshold = 25;
 
@@ -1080,6 +1084,8 @@ static void set_good_speed_features_framesize_independent(
     sf->intra_sf.skip_intra_in_interframe = is_inter_frame ? 2 : 1;
     sf->intra_sf.skip_filter_intra_in_inter_frames = 1;
 
+    sf->tx_sf.prune_tx_depths_using_hadamard = 1;
+
     sf->tpl_sf.prune_starting_mv = 1;
     sf->tpl_sf.search_method = DIAMOND;
 
@@ -1175,6 +1181,7 @@ static void set_good_speed_features_framesize_independent(
 
   if (speed >= 4) {
     sf->mv_sf.subpel_search_method = SUBPEL_TREE_PRUNED_MORE;
+    sf->hl_sf.adaptive_tf_frames = 2;
 
     sf->gm_sf.prune_zero_mv_with_sse = 2;
     sf->gm_sf.downsample_level = 1;
@@ -1257,6 +1264,10 @@ static void set_good_speed_features_framesize_independent(
 
     sf->intra_sf.chroma_intra_pruning_with_hog = 3;
 
+    // With transform size search mostly deferred to the winner modes, the
+    // Hadamard estimates cost more than the depths they prune.
+    sf->tx_sf.prune_tx_depths_using_hadamard = 0;
+
     // TODO(any): Extend multi-winner mode processing support for inter frames
     sf->winner_mode_sf.multi_winner_mode_type =
         frame_is_intra_only(&cpi->common) ? MULTI_WINNER_MODE_FAST
@@ -1693,6 +1704,7 @@ static void set_rt_speed_features_framesize_independent(AV1_COMP *cpi,
   sf->part_sf.reuse_prev_rd_results_for_part_ab = 1;
   sf->part_sf.prune_ext_partition_types_search_level = 2;
   sf->part_sf.less_rectangular_check_level = 2;
+  sf->part_sf.static_sb_skip = 1;
   sf->mv_sf.obmc_full_pixel_search_level = 1;
   sf->intra_sf.dv_cost_upd_level = INTERNAL_COST_UPD_OFF;
   sf->tx_sf.model_based_prune_tx_search_level = 0;
@@ -1975,6 +1987,7 @@ static inline void init_hl_sf(HIGH_LEVEL_SPEED_FEATURES *hl_sf) {
   hl_sf->accurate_bit_estimate = 0;
   hl_sf->weight_calc_level_in_tf = 0;
   hl_sf->allow_sub_blk_me_in_tf = 0;
+  hl_sf->adaptive_tf_frames = 0;
 }
 
 static inline void init_fp_sf(FIRST_PASS_SPEED_FEATURES *fp_sf) {
@@ -2053,6 +2066,7 @@ static inline void init_part_sf(PARTITION_SPEED_FEATURES *part_sf) {
   part_sf->use_best_rd_for_pruning = 0;
   part_sf->skip_non_sq_part_based_on_none = 0;
   part_sf->disable_8x8_part_based_on_qidx = 0;
+  part_sf->static_sb_skip = 0;
 }
 
 static inline void init_mv_sf(MV_SPEED_FEATURES *mv_sf) {
@@ -2074,6 +2088,7 @@ static inline void init_mv_sf(MV_SPEED_FEATURES *mv_sf) {
   mv_sf->disable_extensive_joint_motion_search = 0;
   mv_sf->disable_second_mv = 0;
   mv_sf->skip_fullpel_search_using_startmv = 0;
+  mv_sf->use_sb_mv_field = 0;
   mv_sf->warp_search_method = WARP_SEARCH_SQUARE;
   mv_sf->warp_search_iters = 8;
   mv_sf->use_intrabc = 1;
@@ -2186,6 +2201,7 @@ static inline void init_tx_sf(TX_SPEED_FEATURES *tx_sf) {
   tx_sf->refine_fast_tx_search_results = 1;
   tx_sf->prune_tx_size_level = 0;
   tx_sf->prune_intra_tx_depths_using_nn = false;
+  tx_sf->prune_tx_depths_using_hadamard = 0;
   tx_sf->use_rd_based_breakout_for_intra_tx_search = false;
 }
 
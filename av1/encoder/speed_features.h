@@ -482,6 +482,16 @@ typedef struct HIGH_LEVEL_SPEED_FEATURES {
    * 1: Conditionally allow motion estimation based on 4x4 sub-blocks variance.
    */
   int allow_sub_blk_me_in_tf;
+
+  /*!
+   * Decide the number of frames each block is temporally filtered with.
+   * Reference frames are visited from the nearest to the farthest, and a block
+   * stops using the frames on one side of the filtered frame once a frame adds
+   * little weight, or stops entirely once the accumulated weight saturates.
+   * 0: Filter every block with all the frames.
+   * 1 and 2: Adapt the number of frames per block with varied aggressiveness.
+   */
+  int adaptive_tf_frames;
 } HIGH_LEVEL_SPEED_FEATURES;
 
 /*!
@@ -822,6 +832,11 @@ typedef struct PARTITION_SPEED_FEATURES {
 
   // Disables 8x8 and below partitions for low quantizers.
   int disable_8x8_part_based_on_qidx;
+
+  // Codes superblocks that are unchanged from the previous source and already
+  // well reconstructed in LAST_FRAME as a single GLOBALMV skip block, without
+  // partition, mode or transform search. See av1_compute_static_sb_map().
+  int static_sb_skip;
 } PARTITION_SPEED_FEATURES;
 
 typedef struct MV_SPEED_FEATURES {
@@ -914,6 +929,16 @@ typedef struct MV_SPEED_FEATURES {
   // 2: Skips the full pixel search upto 8 neighbor full-pel MV positions.
   int skip_fullpel_search_using_startmv;
 
+  // Seeds the full pixel search of single reference NEWMV modes with a motion
+  // field computed once per superblock and reference on the image pyramids.
+  // Only applies when the pyramids are allocated (i.e. when global motion is
+  // enabled).
+  // 0: Disabled
+  // 1: Search the motion field MV as an additional start MV, with a small
+  //    search window.
+  // 2: Same as 1, and also shrink the search window of the other start MV.
+  int use_sb_mv_field;
+
   // Method to use for refining WARPED_CAUSAL motion vectors
   // TODO(rachelbarker): Can this be unified with OBMC in some way?
   WARP_SEARCH_METHOD warp_search_method;
@@ -1376,6 +1401,17 @@ typedef struct TX_SPEED_FEATURES {
   // image dataset with coding performance change less than 0.19%.
   bool prune_intra_tx_depths_using_nn;
 
+  // Prune the evaluation of uniform transform depths using an RD estimate
+  // derived from the SATD of Hadamard transforms of the residual. The
+  // estimate is scaled by a per transform size correction learnt from the
+  // exact RD costs seen so far in the superblock, and only depths predicted
+  // to be competitive are searched exactly.
+  // 0: No pruning.
+  // 1: Skip depths predicted to be worse than the best rd by more than 25%.
+  // 2: Skip depths predicted to be worse by more than 12.5%, and search the
+  //    remaining depths predicted to lose with DCT and 1D DCT types only.
+  int prune_tx_depths_using_hadamard;
+
   // Enable/disable early breakout during transform search of intra modes, by
   // using the minimum rd cost possible. By using this approach, the rd
   // evaluation of applicable transform blocks (in the current block) can be
@@ -857,6 +857,34 @@ static void tf_normalize_filtered_frame(
   }
 }
 
+// Fills order with the indices of the frames to filter with. Without
+// adaptive_tf_frames the frames are visited in display order. Otherwise the
+// frame to be filtered comes first, followed by the others from the nearest to
+// the farthest, alternating between the two sides, so that a block can stop
+// once further frames are unlikely to help.
+static void tf_get_frame_order(int num_frames, int filter_frame_idx,
+                               int adaptive_tf_frames, int *order) {
+  if (!adaptive_tf_frames) {
+    for (int frame = 0; frame < num_frames; frame++) order[frame] = frame;
+    return;
+  }
+  int n = 0;
+  order[n++] = filter_frame_idx;
+  for (int dist = 1; dist < num_frames; dist++) {
+    if (filter_frame_idx - dist >= 0) order[n++] = filter_frame_idx - dist;
+    if (filter_frame_idx + dist < num_frames)
+      order[n++] = filter_frame_idx + dist;
+  }
+  assert(n == num_frames);
+}
+
+// Returns the sum of the luma filter weights accumulated in count.
+static int64_t tf_get_luma_weight(const uint16_t *count, int luma_pels) {
+  int64_t weight = 0;
+  for (int i = 0; i < luma_pels; i++) weight += count[i];
+  return weight;
+}
+
 void av1_tf_do_filtering_row(AV1_COMP *cpi, ThreadData *td, int mb_row) {
   TemporalFilterCtx *tf_ctx = &cpi->tf_ctx;
   YV12_BUFFER_CONFIG **frames = tf_ctx->frames;
@@ -878,6 +906,7 @@ void av1_tf_do_filtering_row(AV1_COMP *cpi, ThreadData *td, int mb_row) {
   const int mi_w = mi_size_wide_log2[block_size];
   const int num_planes = av1_num_planes(&cpi->common);
   const int weight_calc_level_in_tf = cpi->sf.hl_sf.weight_calc_level_in_tf;
+  const int adaptive_tf_frames = cpi->sf.hl_sf.adaptive_tf_frames;
   uint32_t *accum = tf_data->accum;
   uint16_t *count = tf_data->count;
   uint8_t *pred = tf_data->pred;
@@ -885,8 +914,23 @@ void av1_tf_do_filtering_row(AV1_COMP *cpi, ThreadData *td, int mb_row) {
   // Factor to control the filering strength.
   const int filter_strength = cpi->oxcf.algo_cfg.arnr_strength;
 
+  // With adaptive_tf_frames, the frames on one side of the frame to be filtered
+  // are no longer used once a frame on that side adds less than
+  // 1 / min_weight_div of the full weight, which happens when the prediction
+  // error is large. A block stops adding frames entirely once the accumulated
+  // weight reaches that of max_frame_weights unfiltered frames.
+  const int min_weight_div = adaptive_tf_frames >= 2 ? 4 : 8;
+  const int max_frame_weights = adaptive_tf_frames >= 2 ? 4 : 5;
+  const int luma_pels = (mb_height >> mbd->plane[AOM_PLANE_Y].subsampling_y) *
+                        (mb_width >> mbd->plane[AOM_PLANE_Y].subsampling_x);
+  const int64_t full_weight = (int64_t)luma_pels * TF_WEIGHT_SCALE;
+  int frame_order[MAX_LAG_BUFFERS];
+  tf_get_frame_order(num_frames, filter_frame_idx, adaptive_tf_frames,
+                     frame_order);
+
   // Do filtering.
   FRAME_DIFF *diff = &td->tf_data.diff;
+  TF_FRAME_STATS *stats = &td->tf_data.stats;
   av1_set_mv_row_limits(&cpi->common.mi_params, &mb->mv_limits,
                         (mb_row << mi_h), (mb_height >> MI_SIZE_LOG2),
                         cpi->oxcf.border_in_pixels);
@@ -898,6 +942,11 @@ void av1_tf_do_filtering_row(AV1_COMP *cpi, ThreadData *td, int mb_row) {
     memset(count, 0, num_pels * sizeof(count[0]));
     MV ref_mv = kZeroMv;  // Reference motion vector passed down along frames.
                           // Perform temporal filtering frame by frame.
+    // With adaptive_tf_frames, each side of the frame to be filtered passes
+    // down its own reference motion vector, and may stop early.
+    MV side_ref_mvs[2] = { kZeroMv, kZeroMv };
+    bool side_done[2] = { false, false };
+    int64_t luma_weight = 0;
 
     // Decide whether to perform motion search at 16x16 sub-block level or not
     // based on 4x4 sub-blocks source variance. Allow motion search for split
@@ -918,12 +967,20 @@ void av1_tf_do_filtering_row(AV1_COMP *cpi, ThreadData *td, int mb_row) {
         allow_me_for_sub_blks = false;
     }
 
-    for (int frame = 0; frame < num_frames; frame++) {
+    for (int i = 0; i < num_frames; i++) {
+      const int frame = frame_order[i];
       if (frames[frame] == NULL) continue;
+      const int side = frame > filter_frame_idx;
+      if (frame != filter_frame_idx && side_done[side]) {
+        ++stats->ref_blocks_skipped;
+        continue;
+      }
 
       // Motion search.
       MV subblock_mvs[4] = { kZeroMv, kZeroMv, kZeroMv, kZeroMv };
       int subblock_mses[4] = { INT_MAX, INT_MAX, INT_MAX, INT_MAX };
+      MV *const frame_ref_mv =
+          adaptive_tf_frames ? &side_ref_mvs[side] : &ref_mv;
       if (frame ==
           filter_frame_idx) {  // Frame to be filtered.
                                // Change ref_mv sign for following frames.
@@ -931,8 +988,9 @@ void av1_tf_do_filtering_row(AV1_COMP *cpi, ThreadData *td, int mb_row) {
         ref_mv.col *= -1;
       } else {  // Other reference frames.
         tf_motion_search(cpi, mb, frame_to_filter, frames[frame], block_size,
-                         mb_row, mb_col, &ref_mv, allow_me_for_sub_blks,
+                         mb_row, mb_col, frame_ref_mv, allow_me_for_sub_blks,
                          subblock_mvs, subblock_mses);
+        ++stats->ref_blocks_filtered;
       }
 
       // Perform weighted averaging.
@@ -980,6 +1038,16 @@ void av1_tf_do_filtering_row(AV1_COMP *cpi, ThreadData *td, int mb_row) {
           }
         }
       }
+
+      if (adaptive_tf_frames) {
+        const int64_t prev_luma_weight = luma_weight;
+        luma_weight = tf_get_luma_weight(count, luma_pels);
+        if (frame != filter_frame_idx &&
+            (luma_weight - prev_luma_weight) * min_weight_div < full_weight)
+          side_done[side] = true;
+        if (luma_weight >= max_frame_weights * full_weight)
+          side_done[0] = side_done[1] = true;
+      }
     }
     tf_normalize_filtered_frame(mbd, block_size, mb_row, mb_col, num_planes,
                                 accum, count, tf_ctx->output_frame);
@@ -1436,6 +1504,11 @@ void av1_temporal_filter(AV1_COMP *cpi, const int filter_frame_lookahead_idx,
   if (compute_frame_diff) {
     *frame_diff = tf_data->diff;
   }
+  tf_ctx->stats = tf_data->stats;
+#if CONFIG_INTERNAL_STATS
+  cpi->ppi->tf_ref_blocks_filtered += tf_data->stats.ref_blocks_filtered;
+  cpi->ppi->tf_ref_blocks_skipped += tf_data->stats.ref_blocks_skipped;
+#endif  // CONFIG_INTERNAL_STATS
   // Deallocate temporal filter buffers.
   tf_dealloc_data(tf_data, is_highbitdepth);
 }
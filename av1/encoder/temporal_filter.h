@@ -90,6 +90,13 @@ typedef struct {
   int64_t sse;
 } FRAME_DIFF;
 
+// Number of reference frame blocks the temporal filter used, and the number it
+// skipped because the block stopped adding frames early.
+typedef struct {
+  int64_t ref_blocks_filtered;
+  int64_t ref_blocks_skipped;
+} TF_FRAME_STATS;
+
 /*!\endcond */
 
 /*!
@@ -146,6 +153,10 @@ typedef struct {
    * Quantization factor used in temporal filtering.
    */
   int q_factor;
+  /*!
+   * Reference frame block counts of the last filtered frame.
+   */
+  TF_FRAME_STATS stats;
 } TemporalFilterCtx;
 
 /*!
@@ -246,6 +257,8 @@ YV12_BUFFER_CONFIG *av1_tf_info_get_filtered_buf(TEMPORAL_FILTER_INFO *tf_info,
 typedef struct {
   // Source vs filtered frame error.
   FRAME_DIFF diff;
+  // Reference frame block counts.
+  TF_FRAME_STATS stats;
   // Pointer to temporary block info used to store state in temporal filtering
   // process.
   MB_MODE_INFO *tmp_mbmi;
@@ -376,6 +389,7 @@ static inline bool tf_alloc_and_reset_data(TemporalFilterData *tf_data,
   if (!(tf_data->tmp_mbmi && tf_data->accum && tf_data->count && tf_data->pred))
     return false;
   memset(&tf_data->diff, 0, sizeof(tf_data->diff));
+  memset(&tf_data->stats, 0, sizeof(tf_data->stats));
   return true;
 }
 
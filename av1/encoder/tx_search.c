@@ -2142,6 +2142,7 @@ static void search_tx_type(const AV1_COMP *cpi, MACROBLOCK *x, int plane,
     if (plane == 0) xd->tx_type_map[tx_type_map_idx] = tx_type;
     RD_STATS this_rd_stats;
     av1_invalid_rd_stats(&this_rd_stats);
+    x->sb_search_pels += tx_size_2d[tx_size];
 
     if (!dc_only_blk)
       av1_xform(x, plane, block, blk_row, blk_col, plane_bsize, &txfm_param);
@@ -2899,6 +2900,108 @@ static int64_t uniform_txfm_yrd(const AV1_COMP *const cpi, MACROBLOCK *x,
   return rd;
 }
 
+// Minimum number of exact RD costs of a transform size collected in the
+// superblock before its Hadamard based estimate is trusted for pruning, and the
+// number after which the first depth searched stops estimating its cost only
+// to add a sample.
+#define TXFM_RD_MODEL_MIN_SAMPLES 4
+#define TXFM_RD_MODEL_MAX_SAMPLES 16
+
+// Estimates the luma RD cost of the current block with a uniform transform
+// size, without running the actual transforms. Each transform block is
+// modelled from the SATD of the Hadamard transforms of its square sub-blocks,
+// so the estimate follows how well the transform size compacts the residual
+// energy. Intra residuals are regenerated per transform block, predicting from
+// whatever is in the destination buffer, as done by intra_model_rd().
+static int64_t estimate_uniform_txfm_yrd(const AV1_COMP *const cpi,
+                                         MACROBLOCK *x, BLOCK_SIZE bs,
+                                         TX_SIZE tx_size) {
+  MACROBLOCKD *const xd = &x->e_mbd;
+  const int is_inter = is_inter_block(xd->mi[0]);
+  const BitDepthInfo bd_info = get_bit_depth_info(xd);
+  struct macroblock_plane *const p = &x->plane[AOM_PLANE_Y];
+  struct macroblockd_plane *const pd = &xd->plane[AOM_PLANE_Y];
+  const int diff_stride = block_size_wide[bs];
+  const int stepr = tx_size_high_unit[tx_size];
+  const int stepc = tx_size_wide_unit[tx_size];
+  const int txbw = tx_size_wide[tx_size];
+  const int txbh = tx_size_high[tx_size];
+  const int num_coeffs = txbw * txbh;
+  const BLOCK_SIZE tx_bsize = txsize_to_bsize[tx_size];
+  const TX_SIZE tile_tx_size = AOMMIN(txsize_sqr_map[tx_size], TX_32X32);
+  const int tile_size = tx_size_wide[tile_tx_size];
+  // Amplitude gain of aom_hadamard_NxN() over an orthonormal transform.
+  const int tile_gain = tile_size == 4 ? 1 : (tile_size == 32 ? 4 : 8);
+  const int bd_shift = xd->bd - 8;
+  const int dequant_shift = is_cur_buf_hbd(xd) ? xd->bd - 5 : 3;
+  const double qstep = AOMMAX(p->dequant_QTX[1] >> dequant_shift, 1);
+  const double satd_scale =
+      1.0 / ((double)tile_gain * num_coeffs * (1 << bd_shift));
+  const double sse_scale = 1.0 / ((double)num_coeffs * (1 << (2 * bd_shift)));
+  const int max_blocks_wide = max_block_wide(xd, bs, 0);
+  const int max_blocks_high = max_block_high(xd, bs, 0);
+  int64_t rate = 0;
+  int64_t dist = 0;
+
+  for (int row = 0; row < max_blocks_high; row += stepr) {
+    for (int col = 0; col < max_blocks_wide; col += stepc) {
+      int16_t *const src_diff = p->src_diff + ((row * diff_stride + col) << 2);
+      if (!is_inter) {
+        av1_predict_intra_block_facade(&cpi->common, xd, AOM_PLANE_Y, col, row,
+                                       tx_size);
+        av1_subtract_block(
+            bd_info, txbh, txbw, src_diff, diff_stride,
+            p->src.buf + (((row * p->src.stride) + col) << 2), p->src.stride,
+            pd->dst.buf + (((row * pd->dst.stride) + col) << 2),
+            pd->dst.stride);
+      }
+      // p->coeff is only used as a scratch buffer here.
+      int64_t satd = 0;
+      uint64_t sse = 0;
+      for (int r = 0; r < txbh; r += tile_size) {
+        for (int c = 0; c < txbw; c += tile_size) {
+          const int16_t *const tile = src_diff + r * diff_stride + c;
+          av1_quick_txfm(/*use_hadamard=*/1, tile_tx_size, bd_info, tile,
+                         diff_stride, p->coeff);
+          satd += aom_satd(p->coeff, tile_size * tile_size);
+          sse += aom_sum_squares_2d_i16(tile, diff_stride, tile_size,
+                                        tile_size);
+        }
+      }
+
+      double rate_f, dist_f;
+      av1_model_rd_satd_curvfit(tx_bsize, (double)sse * sse_scale,
+                                (double)satd * satd_scale, qstep, &rate_f,
+                                &dist_f);
+      const int64_t zero_blk_dist = (int64_t)(sse >> (2 * bd_shift)) << 4;
+      int blk_rate = (int)(AOMMAX(0.0, rate_f * num_coeffs) + 0.5);
+      int64_t blk_dist = (int64_t)(AOMMAX(0.0, dist_f * num_coeffs) * 16 + 0.5);
+      if (blk_rate == 0 || RDCOST(x->rdmult, blk_rate, blk_dist) >=
+                               RDCOST(x->rdmult, 0, zero_blk_dist)) {
+        blk_rate = 0;
+        blk_dist = zero_blk_dist;
+      }
+      rate += blk_rate;
+      dist += blk_dist;
+    }
+  }
+  return RDCOST(x->rdmult, rate, dist);
+}
+
+// Maps a Hadamard based RD estimate of the given transform size to the scale
+// of the exact RD cost, using the calibration samples collected so far in the
+// superblock. Returns INT64_MAX until enough samples are available.
+static inline int64_t calibrate_txfm_rd_estimate(
+    const SuperBlockEnc *sb_enc, TX_SIZE tx_size, int64_t est_rd) {
+  if (sb_enc->txfm_rd_samples[tx_size] < TXFM_RD_MODEL_MIN_SAMPLES ||
+      sb_enc->txfm_rd_est_sum[tx_size] <= 0)
+    return INT64_MAX;
+  const double pred_rd = (double)est_rd *
+                         (double)sb_enc->txfm_rd_exact_sum[tx_size] /
+                         (double)sb_enc->txfm_rd_est_sum[tx_size];
+  return pred_rd < (double)INT64_MAX ? (int64_t)pred_rd : INT64_MAX;
+}
+
 // Search for the best uniform transform size and type for current coding block.
 static inline void choose_tx_size_type_from_rd(const AV1_COMP *const cpi,
                                                MACROBLOCK *x,
@@ -2942,6 +3045,9 @@ static inline void choose_tx_size_type_from_rd(const AV1_COMP *const cpi,
   x->rd_model = FULL_TXFM_RD;
   int64_t rd[MAX_TX_DEPTH + 1] = { INT64_MAX, INT64_MAX, INT64_MAX };
   TxfmSearchInfo *txfm_info = &x->txfm_search_info;
+  SuperBlockEnc *const sb_enc = &x->sb_enc;
+  const int prune_depths_level =
+      tx_select ? cpi->sf.tx_sf.prune_tx_depths_using_hadamard : 0;
   for (int tx_size = start_tx, depth = init_depth; depth <= MAX_TX_DEPTH;
        depth++, tx_size = sub_tx_size_map[tx_size]) {
     if ((!cpi->oxcf.txfm_cfg.enable_tx64 &&
@@ -2962,6 +3068,24 @@ static inline void choose_tx_size_type_from_rd(const AV1_COMP *const cpi,
         (cpi->sf.tx_sf.prune_intra_tx_depths_using_nn && tx_size == start_tx);
 #endif
 
+    // Estimate the rd cost of this depth from its Hadamard transform. Depths
+    // predicted to lose clearly are skipped, the estimate of the ones searched
+    // exactly is used to calibrate the model.
+    FAST_TX_SEARCH_MODE ftxs_mode = FTXS_NONE;
+    int64_t est_rd = INT64_MAX;
+    if (prune_depths_level &&
+        (best_rd != INT64_MAX ||
+         sb_enc->txfm_rd_samples[tx_size] < TXFM_RD_MODEL_MAX_SAMPLES)) {
+      est_rd = estimate_uniform_txfm_yrd(cpi, x, bs, tx_size);
+      const int64_t pred_rd =
+          calibrate_txfm_rd_estimate(sb_enc, tx_size, est_rd);
+      if (best_rd != INT64_MAX && pred_rd != INT64_MAX) {
+        if (pred_rd > best_rd + (best_rd >> (prune_depths_level + 1))) continue;
+        if (prune_depths_level >= 2 && pred_rd > best_rd)
+          ftxs_mode = FTXS_DCT_AND_1D_DCT_ONLY;
+      }
+    }
+
     RD_STATS this_rd_stats;
     // When the speed feature use_rd_based_breakout_for_intra_tx_search is
     // enabled, use the known minimum best_rd for early termination.
@@ -2970,7 +3094,13 @@ static inline void choose_tx_size_type_from_rd(const AV1_COMP *const cpi,
             ? AOMMIN(ref_best_rd, best_rd)
             : ref_best_rd;
     rd[depth] = uniform_txfm_yrd(cpi, x, &this_rd_stats, rd_thresh, bs, tx_size,
-                                 FTXS_NONE, skip_trellis);
+                                 ftxs_mode, skip_trellis);
+    if (est_rd != INT64_MAX && rd[depth] != INT64_MAX &&
+        ftxs_mode == FTXS_NONE) {
+      sb_enc->txfm_rd_exact_sum[tx_size] += rd[depth];
+      sb_enc->txfm_rd_est_sum[tx_size] += est_rd;
+      ++sb_enc->txfm_rd_samples[tx_size];
+    }
     if (rd[depth] < best_rd) {
       av1_copy_array(best_blk_skip, txfm_info->blk_skip, num_blks);
       av1_copy_array(best_txk_type_map, xd->tx_type_map, num_blks);
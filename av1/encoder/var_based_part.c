@@ -432,21 +432,29 @@ static int64_t scale_part_thresh_content(int64_t threshold_base, int speed,
   return threshold;
 }
 
+// Returns the threshold raised by the given shift, unless weight is 1. The
+// result saturates at INT_MAX, where converting the floating point form to int
+// was undefined and gave different results on x86 and ARM.
+static inline int64_t raise_thresh(int64_t thresh, int weight, int shift) {
+  if (!weight) thresh = thresh > (INT_MAX >> shift) ? INT_MAX : thresh << shift;
+  return AOMMIN(thresh, INT_MAX);
+}
+
 // Tune thresholds less or more aggressively to prefer larger partitions
 static inline void tune_thresh_based_on_qindex(
     AV1_COMP *cpi, int64_t thresholds[], uint64_t block_sad, int current_qindex,
     int num_pixels, bool is_segment_id_boosted, int source_sad_nonrd,
     int lighting_change) {
-  double weight;
+  // The weight is 0 or 1, and selects whether the thresholds are raised.
+  int weight;
   if (cpi->sf.rt_sf.prefer_large_partition_blocks >= 3) {
     const int win = 20;
     if (current_qindex < QINDEX_LARGE_BLOCK_THR - win)
-      weight = 1.0;
+      weight = 1;
     else if (current_qindex > QINDEX_LARGE_BLOCK_THR + win)
-      weight = 0.0;
+      weight = 0;
     else
-      weight =
-          1.0 - (current_qindex - QINDEX_LARGE_BLOCK_THR + win) / (2 * win);
+      weight = 1 - (current_qindex - QINDEX_LARGE_BLOCK_THR + win) / (2 * win);
     if (num_pixels > RESOLUTION_480P) {
       for (int i = 0; i < 4; i++) {
         thresholds[i] <<= 1;
@@ -493,19 +501,15 @@ static inline void tune_thresh_based_on_qindex(
       thresholds[0] = (3 * thresholds[0]) >> 1;
       thresholds[3] = INT64_MAX;
       if (current_qindex > QINDEX_LARGE_BLOCK_THR) {
-        thresholds[1] =
-            (int)((1 - weight) * (thresholds[1] << 1) + weight * thresholds[1]);
-        thresholds[2] =
-            (int)((1 - weight) * (thresholds[2] << 1) + weight * thresholds[2]);
+        thresholds[1] = raise_thresh(thresholds[1], weight, 1);
+        thresholds[2] = raise_thresh(thresholds[2], weight, 1);
       }
     } else if (current_qindex > QINDEX_LARGE_BLOCK_THR &&
                is_segment_id_boosted == false &&
                (source_sad_nonrd != kHighSad ||
                 cpi->rc.avg_source_sad > 50000)) {
-      thresholds[1] =
-          (int)((1 - weight) * (thresholds[1] << 2) + weight * thresholds[1]);
-      thresholds[2] =
-          (int)((1 - weight) * (thresholds[2] << 4) + weight * thresholds[2]);
+      thresholds[1] = raise_thresh(thresholds[1], weight, 2);
+      thresholds[2] = raise_thresh(thresholds[2], weight, 4);
       thresholds[3] = INT64_MAX;
     }
   } else if (cpi->sf.rt_sf.prefer_large_partition_blocks >= 2) {
@@ -515,17 +519,14 @@ static inline void tune_thresh_based_on_qindex(
   } else if (cpi->sf.rt_sf.prefer_large_partition_blocks >= 1) {
     const int fac = (source_sad_nonrd <= kLowSad) ? 2 : 1;
     if (current_qindex < QINDEX_LARGE_BLOCK_THR - 45)
-      weight = 1.0;
+      weight = 1;
     else if (current_qindex > QINDEX_LARGE_BLOCK_THR + 45)
-      weight = 0.0;
+      weight = 0;
     else
-      weight = 1.0 - (current_qindex - QINDEX_LARGE_BLOCK_THR + 45) / (2 * 45);
-    thresholds[1] =
-        (int)((1 - weight) * (thresholds[1] << 1) + weight * thresholds[1]);
-    thresholds[2] =
-        (int)((1 - weight) * (thresholds[2] << 1) + weight * thresholds[2]);
-    thresholds[3] =
-        (int)((1 - weight) * (thresholds[3] << fac) + weight * thresholds[3]);
+      weight = 1 - (current_qindex - QINDEX_LARGE_BLOCK_THR + 45) / (2 * 45);
+    thresholds[1] = raise_thresh(thresholds[1], weight, 1);
+    thresholds[2] = raise_thresh(thresholds[2], weight, 1);
+    thresholds[3] = raise_thresh(thresholds[3], weight, fac);
   }
   if (cpi->sf.part_sf.disable_8x8_part_based_on_qidx && (current_qindex < 128))
     thresholds[3] = INT64_MAX;
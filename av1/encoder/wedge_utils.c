@@ -104,6 +104,50 @@ int8_t av1_wedge_sign_from_residuals_c(const int16_t *ds, const uint8_t *m,
   return acc > limit;
 }
 
+/**
+ * Computes av1_wedge_sse_from_residuals() for several masks in a single pass
+ * over the residuals.
+ *
+ * masks:     num_masks blending masks, each of N contiguous values.
+ * num_masks: Number of masks, at most MAX_WEDGE_TYPES.
+ * sse:       Output, sse[k] is the result for masks[k].
+ */
+void av1_wedge_sse_from_residuals_multi_c(const int16_t *r1, const int16_t *d,
+                                          const uint8_t *const *masks,
+                                          int num_masks, int N,
+                                          uint64_t *sse) {
+  uint64_t csse[MAX_WEDGE_TYPES] = { 0 };
+  assert(num_masks <= MAX_WEDGE_TYPES);
+
+  for (int i = 0; i < N; i++) {
+    const int32_t r = MAX_MASK_VALUE * r1[i];
+    for (int k = 0; k < num_masks; k++) {
+      int32_t t = r + masks[k][i] * d[i];
+      t = clamp(t, INT16_MIN, INT16_MAX);
+      csse[k] += t * t;
+    }
+  }
+  for (int k = 0; k < num_masks; k++)
+    sse[k] = ROUND_POWER_OF_TWO(csse[k], 2 * WEDGE_WEIGHT_BITS);
+}
+
+/**
+ * Computes av1_wedge_sign_from_residuals() for several masks in a single pass
+ * over 'ds'. signs[k] is the result for masks[k].
+ */
+void av1_wedge_sign_from_residuals_multi_c(const int16_t *ds,
+                                           const uint8_t *const *masks,
+                                           int num_masks, int N, int64_t limit,
+                                           int8_t *signs) {
+  int64_t acc[MAX_WEDGE_TYPES] = { 0 };
+  assert(num_masks <= MAX_WEDGE_TYPES);
+
+  for (int i = 0; i < N; i++) {
+    for (int k = 0; k < num_masks; k++) acc[k] += ds[i] * masks[k][i];
+  }
+  for (int k = 0; k < num_masks; k++) signs[k] = acc[k] > limit;
+}
+
 /**
  * Compute the element-wise difference of the squares of 2 arrays.
  *
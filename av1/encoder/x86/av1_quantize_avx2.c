@@ -185,6 +185,98 @@ void av1_quantize_lp_avx2(const int16_t *coeff_ptr, intptr_t n_coeffs,
   *eob_ptr = accumulate_eob256(eob256);
 }
 
+static AOM_FORCE_INLINE void quantize_lp_dist_16(
+    const int16_t *coeff_ptr, const int16_t *iscan_ptr, int16_t *qcoeff_ptr,
+    int16_t *dqcoeff_ptr, const __m256i *round256, const __m256i *quant256,
+    const __m256i *dequant256, __m256i *eob, __m256i *error,
+    __m256i *abs_sum) {
+  const __m256i zero = _mm256_setzero_si256();
+  const __m256i coeff = _mm256_loadu_si256((const __m256i *)coeff_ptr);
+  const __m256i abs_coeff = _mm256_abs_epi16(coeff);
+  const __m256i tmp_rnd = _mm256_adds_epi16(abs_coeff, *round256);
+  const __m256i abs_qcoeff = _mm256_mulhi_epi16(tmp_rnd, *quant256);
+  const __m256i qcoeff = _mm256_sign_epi16(abs_qcoeff, coeff);
+  const __m256i dqcoeff = _mm256_mullo_epi16(qcoeff, *dequant256);
+  const __m256i nz_mask = _mm256_cmpgt_epi16(abs_qcoeff, zero);
+
+  _mm256_storeu_si256((__m256i *)qcoeff_ptr, qcoeff);
+  _mm256_storeu_si256((__m256i *)dqcoeff_ptr, dqcoeff);
+
+  const __m256i iscan = _mm256_loadu_si256((const __m256i *)iscan_ptr);
+  const __m256i iscan_plus1 = _mm256_sub_epi16(iscan, nz_mask);
+  const __m256i nz_iscan = _mm256_and_si256(iscan_plus1, nz_mask);
+  *eob = _mm256_max_epi16(*eob, nz_iscan);
+
+  // Each 32-bit lane of the squared error holds the sum of two squares, so it
+  // is zero-extended to 64 bits before being accumulated.
+  const __m256i diff = _mm256_sub_epi16(dqcoeff, coeff);
+  const __m256i err = _mm256_madd_epi16(diff, diff);
+  *error = _mm256_add_epi64(*error, _mm256_unpacklo_epi32(err, zero));
+  *error = _mm256_add_epi64(*error, _mm256_unpackhi_epi32(err, zero));
+  *abs_sum = _mm256_add_epi32(
+      *abs_sum, _mm256_madd_epi16(abs_qcoeff, _mm256_set1_epi16(1)));
+}
+
+int64_t av1_quantize_lp_dist_avx2(const int16_t *coeff_ptr, intptr_t n_coeffs,
+                                  const int16_t *round_ptr,
+                                  const int16_t *quant_ptr, int16_t *qcoeff_ptr,
+                                  int16_t *dqcoeff_ptr,
+                                  const int16_t *dequant_ptr, uint16_t *eob_ptr,
+                                  const int16_t *scan, const int16_t *iscan,
+                                  int *qcoeff_abs_sum) {
+  (void)scan;
+  __m256i eob256 = _mm256_setzero_si256();
+  __m256i error256 = _mm256_setzero_si256();
+  __m256i abs_sum256 = _mm256_setzero_si256();
+
+  // Setup global values.
+  __m256i round256 =
+      _mm256_castsi128_si256(_mm_load_si128((const __m128i *)round_ptr));
+  __m256i quant256 =
+      _mm256_castsi128_si256(_mm_load_si128((const __m128i *)quant_ptr));
+  __m256i dequant256 =
+      _mm256_castsi128_si256(_mm_load_si128((const __m128i *)dequant_ptr));
+
+  // Populate upper AC values.
+  round256 = _mm256_permute4x64_epi64(round256, 0x54);
+  quant256 = _mm256_permute4x64_epi64(quant256, 0x54);
+  dequant256 = _mm256_permute4x64_epi64(dequant256, 0x54);
+
+  // Process DC and the first 15 AC coeffs.
+  quantize_lp_dist_16(coeff_ptr, iscan, qcoeff_ptr, dqcoeff_ptr, &round256,
+                      &quant256, &dequant256, &eob256, &error256, &abs_sum256);
+
+  if (n_coeffs > 16) {
+    // Overwrite the DC constants with AC constants
+    dequant256 = _mm256_permute2x128_si256(dequant256, dequant256, 0x31);
+    quant256 = _mm256_permute2x128_si256(quant256, quant256, 0x31);
+    round256 = _mm256_permute2x128_si256(round256, round256, 0x31);
+
+    // AC only loop.
+    for (int idx = 16; idx < n_coeffs; idx += 16) {
+      quantize_lp_dist_16(coeff_ptr + idx, iscan + idx, qcoeff_ptr + idx,
+                          dqcoeff_ptr + idx, &round256, &quant256, &dequant256,
+                          &eob256, &error256, &abs_sum256);
+    }
+  }
+
+  *eob_ptr = accumulate_eob256(eob256);
+
+  const __m128i abs_sum128 =
+      _mm_add_epi32(_mm256_castsi256_si128(abs_sum256),
+                    _mm256_extractf128_si256(abs_sum256, 1));
+  __m128i abs_sum = _mm_add_epi32(abs_sum128, _mm_srli_si128(abs_sum128, 8));
+  abs_sum = _mm_add_epi32(abs_sum, _mm_srli_si128(abs_sum, 4));
+  *qcoeff_abs_sum = _mm_cvtsi128_si32(abs_sum);
+
+  __m128i error = _mm_add_epi64(_mm256_castsi256_si128(error256),
+                                _mm256_extractf128_si256(error256, 1));
+  error = _mm_add_epi64(error, _mm_srli_si128(error, 8));
+  int64_t sse;
+  _mm_storel_epi64((__m128i *)&sse, error);
+  return sse;
+}
+
 static AOM_FORCE_INLINE __m256i get_max_lane_eob(const int16_t *iscan,
                                                  __m256i v_eobmax,
                                                  __m256i v_mask) {
@@ -150,6 +150,130 @@ int8_t av1_wedge_sign_from_residuals_avx2(const int16_t *ds, const uint8_t *m,
   return acc > limit;
 }
 
+static inline uint64_t hsum_epi64(__m256i v_acc_q) {
+  uint64_t sum;
+  v_acc_q = _mm256_add_epi64(v_acc_q, _mm256_srli_si256(v_acc_q, 8));
+  __m128i v_acc_q_0 = _mm256_castsi256_si128(v_acc_q);
+  __m128i v_acc_q_1 = _mm256_extracti128_si256(v_acc_q, 1);
+  v_acc_q_0 = _mm_add_epi64(v_acc_q_0, v_acc_q_1);
+#if AOM_ARCH_X86_64
+  sum = (uint64_t)_mm_extract_epi64(v_acc_q_0, 0);
+#else
+  xx_storel_64(&sum, v_acc_q_0);
+#endif
+  return sum;
+}
+
+/**
+ * See av1_wedge_sse_from_residuals_multi_c
+ */
+void av1_wedge_sse_from_residuals_multi_avx2(const int16_t *r1,
+                                             const int16_t *d,
+                                             const uint8_t *const *masks,
+                                             int num_masks, int N,
+                                             uint64_t *sse) {
+  const __m256i v_mask_max_w = _mm256_set1_epi16(MAX_MASK_VALUE);
+  const __m256i v_zext_q = _mm256_set1_epi64x(~0u);
+  __m256i v_acc_q[MAX_WEDGE_TYPES];
+
+  assert(N % 64 == 0);
+  assert(num_masks <= MAX_WEDGE_TYPES);
+
+  for (int k = 0; k < num_masks; k++) v_acc_q[k] = _mm256_setzero_si256();
+
+  // The residuals are loaded and interleaved once per 16 pixels, then blended
+  // with each of the masks in turn.
+  for (int i = 0; i < N; i += 16) {
+    const __m256i v_r0_w = _mm256_lddqu_si256((__m256i *)(r1 + i));
+    const __m256i v_d0_w = _mm256_lddqu_si256((__m256i *)(d + i));
+
+    const __m256i v_rd0l_w = _mm256_unpacklo_epi16(v_d0_w, v_r0_w);
+    const __m256i v_rd0h_w = _mm256_unpackhi_epi16(v_d0_w, v_r0_w);
+
+    for (int k = 0; k < num_masks; k++) {
+      const __m128i v_m01_b = _mm_lddqu_si128((__m128i *)(masks[k] + i));
+      const __m256i v_m0_w = _mm256_cvtepu8_epi16(v_m01_b);
+
+      const __m256i v_m0l_w = _mm256_unpacklo_epi16(v_m0_w, v_mask_max_w);
+      const __m256i v_m0h_w = _mm256_unpackhi_epi16(v_m0_w, v_mask_max_w);
+
+      const __m256i v_t0l_d = _mm256_madd_epi16(v_rd0l_w, v_m0l_w);
+      const __m256i v_t0h_d = _mm256_madd_epi16(v_rd0h_w, v_m0h_w);
+
+      const __m256i v_t0_w = _mm256_packs_epi32(v_t0l_d, v_t0h_d);
+
+      const __m256i v_sq0_d = _mm256_madd_epi16(v_t0_w, v_t0_w);
+
+      const __m256i v_sum0_q = _mm256_add_epi64(
+          _mm256_and_si256(v_sq0_d, v_zext_q), _mm256_srli_epi64(v_sq0_d, 32));
+
+      v_acc_q[k] = _mm256_add_epi64(v_acc_q[k], v_sum0_q);
+    }
+  }
+
+  for (int k = 0; k < num_masks; k++) {
+    sse[k] = ROUND_POWER_OF_TWO(hsum_epi64(v_acc_q[k]), 2 * WEDGE_WEIGHT_BITS);
+  }
+}
+
+/**
+ * See av1_wedge_sign_from_residuals_multi_c
+ */
+void av1_wedge_sign_from_residuals_multi_avx2(const int16_t *ds,
+                                              const uint8_t *const *masks,
+                                              int num_masks, int N,
+                                              int64_t limit, int8_t *signs) {
+  __m256i v_acc_d[MAX_WEDGE_TYPES];
+
+  // Same 32 bit accumulator limit as av1_wedge_sign_from_residuals_avx2().
+  assert(N < 8192);
+  assert(N % 64 == 0);
+  assert(num_masks <= MAX_WEDGE_TYPES);
+
+  for (int k = 0; k < num_masks; k++) v_acc_d[k] = _mm256_setzero_si256();
+
+  for (int i = 0; i < N; i += 64) {
+    const __m256i v_d0_w = _mm256_lddqu_si256((__m256i *)(ds + i));
+    const __m256i v_d1_w = _mm256_lddqu_si256((__m256i *)(ds + i + 16));
+    const __m256i v_d2_w = _mm256_lddqu_si256((__m256i *)(ds + i + 32));
+    const __m256i v_d3_w = _mm256_lddqu_si256((__m256i *)(ds + i + 48));
+
+    for (int k = 0; k < num_masks; k++) {
+      const uint8_t *const m = masks[k] + i;
+      const __m256i v_m01_b = _mm256_lddqu_si256((__m256i *)(m));
+      const __m256i v_m23_b = _mm256_lddqu_si256((__m256i *)(m + 32));
+
+      const __m256i v_m0_w =
+          _mm256_cvtepu8_epi16(_mm256_castsi256_si128(v_m01_b));
+      const __m256i v_m1_w =
+          _mm256_cvtepu8_epi16(_mm256_extracti128_si256(v_m01_b, 1));
+      const __m256i v_m2_w =
+          _mm256_cvtepu8_epi16(_mm256_castsi256_si128(v_m23_b));
+      const __m256i v_m3_w =
+          _mm256_cvtepu8_epi16(_mm256_extracti128_si256(v_m23_b, 1));
+
+      const __m256i v_p0_d = _mm256_madd_epi16(v_d0_w, v_m0_w);
+      const __m256i v_p1_d = _mm256_madd_epi16(v_d1_w, v_m1_w);
+      const __m256i v_p2_d = _mm256_madd_epi16(v_d2_w, v_m2_w);
+      const __m256i v_p3_d = _mm256_madd_epi16(v_d3_w, v_m3_w);
+
+      const __m256i v_p01_d = _mm256_add_epi32(v_p0_d, v_p1_d);
+      const __m256i v_p23_d = _mm256_add_epi32(v_p2_d, v_p3_d);
+
+      v_acc_d[k] = _mm256_add_epi32(v_acc_d[k],
+                                    _mm256_add_epi32(v_p01_d, v_p23_d));
+    }
+  }
+
+  for (int k = 0; k < num_masks; k++) {
+    const __m256i v_sign_d = _mm256_srai_epi32(v_acc_d[k], 31);
+    const __m256i v_acc_q =
+        _mm256_add_epi64(_mm256_unpacklo_epi32(v_acc_d[k], v_sign_d),
+                         _mm256_unpackhi_epi32(v_acc_d[k], v_sign_d));
+    signs[k] = (int64_t)hsum_epi64(v_acc_q) > limit;
+  }
+}
+
 /**
  * av1_wedge_compute_delta_squares_c
  */
@@ -100,6 +100,8 @@ set_aom_config_var(CONFIG_DEBUG 0 "Enable debug-only code.")
 set_aom_config_var(CONFIG_EXCLUDE_SIMD_MISMATCH 0
                    "Exclude mismatch in SIMD functions for testing/debugging.")
 set_aom_config_var(CONFIG_MISMATCH_DEBUG 0 "Mismatch debugging flag.")
+set_aom_config_var(CONFIG_ZERO_FRAME_BUFFERS 0
+                   "Zero-fill frame buffers when they are allocated.")
 
 # AV1 feature flags.
 set_aom_config_var(CONFIG_ACCOUNTING 0 "Enables bit accounting.")
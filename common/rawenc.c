@@ -31,6 +31,11 @@ static void write_md5(void *md5, const uint8_t *buffer, unsigned int size,
   MD5Update((MD5Context *)md5, buffer, size * nmemb);
 }
 
+static void write_xxhash(void *xxh64, const uint8_t *buffer, unsigned int size,
+                         unsigned int nmemb) {
+  XXH64Update((XXH64Context *)xxh64, buffer, (size_t)size * nmemb);
+}
+
 // Writes out n neutral chroma samples (for greyscale).
 static void write_greyscale(const aom_image_t *img, int n, WRITER writer_func,
                             void *file_or_md5) {
@@ -97,3 +102,8 @@ void raw_update_image_md5(const aom_image_t *img, const int *planes,
                           const int num_planes, MD5Context *md5) {
   raw_write_image_file_or_md5(img, planes, num_planes, md5, write_md5);
 }
+
+void raw_update_image_xxhash(const aom_image_t *img, const int *planes,
+                             const int num_planes, XXH64Context *xxh64) {
+  raw_write_image_file_or_md5(img, planes, num_planes, xxh64, write_xxhash);
+}
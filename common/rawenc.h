@@ -15,6 +15,7 @@
 #include "aom/aom_decoder.h"
 #include "common/md5_utils.h"
 #include "common/tools_common.h"
+#include "common/xxhash_utils.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -24,6 +25,8 @@ void raw_write_image_file(const aom_image_t *img, const int *planes,
                           const int num_planes, FILE *file);
 void raw_update_image_md5(const aom_image_t *img, const int *planes,
                           const int num_planes, MD5Context *md5);
+void raw_update_image_xxhash(const aom_image_t *img, const int *planes,
+                             const int num_planes, XXH64Context *xxh64);
 
 #ifdef __cplusplus
 }  // extern "C"
@@ -528,8 +528,8 @@ bool aom_shift_img(unsigned int output_bit_depth, aom_image_t **img_ptr,
     }
     if (output_bit_depth > img->bit_depth) {
       aom_img_upshift(img_shifted, img, output_bit_depth - img->bit_depth);
-    } else {
-      aom_img_downshift(img_shifted, img, img->bit_depth - output_bit_depth);
+    } else if (aom_img_convert(img_shifted, img, 1)) {
+      fatal("Unsupported image conversion");
     }
     *img_shifted_ptr = img_shifted;
     *img_ptr = img_shifted;
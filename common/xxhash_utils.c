@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2024, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include <string.h>
+
+#include "common/xxhash_utils.h"
+
+#define PRIME64_1 0x9E3779B185EBCA87ULL
+#define PRIME64_2 0xC2B2AE3D27D4EB4FULL
+#define PRIME64_3 0x165667B19E3779F9ULL
+#define PRIME64_4 0x85EBCA77C2B2AE63ULL
+#define PRIME64_5 0x27D4EB2F165667C5ULL
+
+static inline uint64_t rotl64(uint64_t x, int r) {
+  return (x << r) | (x >> (64 - r));
+}
+
+// Reads little endian values, independent of the host byte order.
+static inline uint64_t read64(const unsigned char *p) {
+  return (uint64_t)p[0] | ((uint64_t)p[1] << 8) | ((uint64_t)p[2] << 16) |
+         ((uint64_t)p[3] << 24) | ((uint64_t)p[4] << 32) |
+         ((uint64_t)p[5] << 40) | ((uint64_t)p[6] << 48) |
+         ((uint64_t)p[7] << 56);
+}
+
+static inline uint32_t read32(const unsigned char *p) {
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) |
+         ((uint32_t)p[3] << 24);
+}
+
+static inline uint64_t xxh64_round(uint64_t acc, uint64_t input) {
+  acc += input * PRIME64_2;
+  acc = rotl64(acc, 31);
+  return acc * PRIME64_1;
+}
+
+static inline uint64_t xxh64_merge_round(uint64_t acc, uint64_t val) {
+  acc ^= xxh64_round(0, val);
+  return acc * PRIME64_1 + PRIME64_4;
+}
+
+// Consumes whole 32-byte stripes. The four lanes are independent, so their
+// multiplies overlap in the pipeline.
+static const unsigned char *consume_stripes(uint64_t acc[4],
+                                            const unsigned char *p,
+                                            const unsigned char *end) {
+  uint64_t a0 = acc[0], a1 = acc[1], a2 = acc[2], a3 = acc[3];
+  while (end - p >= 32) {
+    a0 = xxh64_round(a0, read64(p));
+    a1 = xxh64_round(a1, read64(p + 8));
+    a2 = xxh64_round(a2, read64(p + 16));
+    a3 = xxh64_round(a3, read64(p + 24));
+    p += 32;
+  }
+  acc[0] = a0;
+  acc[1] = a1;
+  acc[2] = a2;
+  acc[3] = a3;
+  return p;
+}
+
+void XXH64Init(XXH64Context *context) {
+  context->acc[0] = PRIME64_1 + PRIME64_2;
+  context->acc[1] = PRIME64_2;
+  context->acc[2] = 0;
+  context->acc[3] = 0 - PRIME64_1;
+  context->total_len = 0;
+  context->buf_size = 0;
+}
+
+void XXH64Update(XXH64Context *context, const unsigned char *buf, size_t len) {
+  const unsigned char *p = buf;
+  const unsigned char *const end = buf + len;
+  context->total_len += len;
+
+  if (context->buf_size + len < 32) {
+    if (len) memcpy(context->buf + context->buf_size, buf, len);
+    context->buf_size += (unsigned int)len;
+    return;
+  }
+  if (context->buf_size) {
+    const size_t fill = 32 - context->buf_size;
+    memcpy(context->buf + context->buf_size, p, fill);
+    consume_stripes(context->acc, context->buf, context->buf + 32);
+    p += fill;
+    context->buf_size = 0;
+  }
+  p = consume_stripes(context->acc, p, end);
+  if (p < end) {
+    memcpy(context->buf, p, (size_t)(end - p));
+    context->buf_size = (unsigned int)(end - p);
+  }
+}
+
+uint64_t XXH64Final(const XXH64Context *context) {
+  const uint64_t *const acc = context->acc;
+  uint64_t h;
+  if (context->total_len >= 32) {
+    h = rotl64(acc[0], 1) + rotl64(acc[1], 7) + rotl64(acc[2], 12) +
+        rotl64(acc[3], 18);
+    for (int i = 0; i < 4; ++i) h = xxh64_merge_round(h, acc[i]);
+  } else {
+    h = acc[2] + PRIME64_5;
+  }
+  h += context->total_len;
+
+  const unsigned char *p = context->buf;
+  const unsigned char *const end = p + context->buf_size;
+  for (; end - p >= 8; p += 8) {
+    h ^= xxh64_round(0, read64(p));
+    h = rotl64(h, 27) * PRIME64_1 + PRIME64_4;
+  }
+  if (end - p >= 4) {
+    h ^= (uint64_t)read32(p) * PRIME64_1;
+    h = rotl64(h, 23) * PRIME64_2 + PRIME64_3;
+    p += 4;
+  }
+  for (; p < end; ++p) {
+    h ^= (uint64_t)(*p) * PRIME64_5;
+    h = rotl64(h, 11) * PRIME64_1;
+  }
+
+  h ^= h >> 33;
+  h *= PRIME64_2;
+  h ^= h >> 29;
+  h *= PRIME64_3;
+  h ^= h >> 32;
+  return h;
+}
@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2024, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+#ifndef AOM_COMMON_XXHASH_UTILS_H_
+#define AOM_COMMON_XXHASH_UTILS_H_
+
+#include <stddef.h>
+
+#include "aom/aom_integer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Streaming XXH64 hash with a seed of 0. The digest matches the reference
+// xxHash implementation (xxhsum -H1), so output hashed with aomdec --xxhash
+// can be checked against a hash of the written file. It is about an order of
+// magnitude faster than MD5, which matters when hashing high resolution
+// decoder output.
+typedef struct XXH64Context {
+  uint64_t acc[4];
+  uint64_t total_len;
+  unsigned char buf[32];
+  unsigned int buf_size;
+} XXH64Context;
+
+void XXH64Init(XXH64Context *context);
+void XXH64Update(XXH64Context *context, const unsigned char *buf, size_t len);
+// Returns the hash of all data passed to XXH64Update() so far. The context is
+// not modified, so hashing may continue afterwards.
+uint64_t XXH64Final(const XXH64Context *context);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif  // AOM_COMMON_XXHASH_UTILS_H_
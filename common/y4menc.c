@@ -106,3 +106,9 @@ void y4m_update_image_md5(const aom_image_t *img, const int *planes,
   int num_planes = img->monochrome ? 1 : 3;
   raw_update_image_md5(img, planes, num_planes, md5);
 }
+
+void y4m_update_image_xxhash(const aom_image_t *img, const int *planes,
+                             XXH64Context *xxh64) {
+  int num_planes = img->monochrome ? 1 : 3;
+  raw_update_image_xxhash(img, planes, num_planes, xxh64);
+}
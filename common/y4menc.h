@@ -15,6 +15,7 @@
 #include "aom/aom_decoder.h"
 #include "common/md5_utils.h"
 #include "common/tools_common.h"
+#include "common/xxhash_utils.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -31,6 +32,8 @@ void y4m_write_image_file(const aom_image_t *img, const int *planes,
                           FILE *file);
 void y4m_update_image_md5(const aom_image_t *img, const int *planes,
                           MD5Context *md5);
+void y4m_update_image_xxhash(const aom_image_t *img, const int *planes,
+                             XXH64Context *xxh64);
 
 #ifdef __cplusplus
 }  // extern "C"
@@ -226,6 +226,14 @@ static int parse_tags(y4m_input *y4m_ctx, FILE *file) {
 #define OC_MAXI(_a, _b) ((_a) < (_b) ? (_b) : (_a))
 #define OC_CLAMPI(_a, _b, _c) (OC_MAXI(_a, OC_MINI(_b, _c)))
 
+/*Vertical filters run over whole rows, with the edge rows repeated, so the
+   inner loops read contiguous memory and have no per-pixel edge checks.
+  This lets the compiler vectorize them.*/
+static const unsigned char *y4m_clamped_row(const unsigned char *_src, int _y,
+                                            int _c_w, int _c_h) {
+  return _src + OC_CLAMPI(0, _y, _c_h - 1) * _c_w;
+}
+
 /*420jpeg chroma samples are sited like:
   Y-------Y-------Y-------Y-------
   |       |       |       |
@@ -376,77 +384,43 @@ static void y4m_convert_42xpaldv_42xjpeg(y4m_input *_y4m, unsigned char *_dst,
       case 1: {
         /*Slide C_b up a quarter-pel.
           This is the same filter used above, but in the other order.*/
-        for (x = 0; x < c_w; x++) {
-          for (y = 0; y < OC_MINI(c_h, 3); y++) {
-            _dst[y * c_w] = (unsigned char)OC_CLAMPI(
+        for (y = 0; y < c_h; y++) {
+          const unsigned char *r0 = y4m_clamped_row(tmp, y - 3, c_w, c_h);
+          const unsigned char *r1 = y4m_clamped_row(tmp, y - 2, c_w, c_h);
+          const unsigned char *r2 = y4m_clamped_row(tmp, y - 1, c_w, c_h);
+          const unsigned char *r3 = y4m_clamped_row(tmp, y, c_w, c_h);
+          const unsigned char *r4 = y4m_clamped_row(tmp, y + 1, c_w, c_h);
+          const unsigned char *r5 = y4m_clamped_row(tmp, y + 2, c_w, c_h);
+          for (x = 0; x < c_w; x++) {
+            _dst[x] = (unsigned char)OC_CLAMPI(
                 0,
-                (tmp[0] - 9 * tmp[OC_MAXI(y - 2, 0) * c_w] +
-                 35 * tmp[OC_MAXI(y - 1, 0) * c_w] + 114 * tmp[y * c_w] -
-                 17 * tmp[OC_MINI(y + 1, c_h - 1) * c_w] +
-                 4 * tmp[OC_MINI(y + 2, c_h - 1) * c_w] + 64) >>
+                (r0[x] - 9 * r1[x] + 35 * r2[x] + 114 * r3[x] - 17 * r4[x] +
+                 4 * r5[x] + 64) >>
                     7,
                 255);
           }
-          for (; y < c_h - 2; y++) {
-            _dst[y * c_w] = (unsigned char)OC_CLAMPI(
-                0,
-                (tmp[(y - 3) * c_w] - 9 * tmp[(y - 2) * c_w] +
-                 35 * tmp[(y - 1) * c_w] + 114 * tmp[y * c_w] -
-                 17 * tmp[(y + 1) * c_w] + 4 * tmp[(y + 2) * c_w] + 64) >>
-                    7,
-                255);
-          }
-          for (; y < c_h; y++) {
-            _dst[y * c_w] = (unsigned char)OC_CLAMPI(
-                0,
-                (tmp[(y - 3) * c_w] - 9 * tmp[(y - 2) * c_w] +
-                 35 * tmp[(y - 1) * c_w] + 114 * tmp[y * c_w] -
-                 17 * tmp[OC_MINI(y + 1, c_h - 1) * c_w] +
-                 4 * tmp[(c_h - 1) * c_w] + 64) >>
-                    7,
-                255);
-          }
-          _dst++;
-          tmp++;
+          _dst += c_w;
         }
-        _dst += c_sz - c_w;
-        tmp -= c_w;
       } break;
       case 2: {
         /*Slide C_r down a quarter-pel.
           This is the same as the horizontal filter.*/
-        for (x = 0; x < c_w; x++) {
-          for (y = 0; y < OC_MINI(c_h, 2); y++) {
-            _dst[y * c_w] = (unsigned char)OC_CLAMPI(
+        for (y = 0; y < c_h; y++) {
+          const unsigned char *r0 = y4m_clamped_row(tmp, y - 2, c_w, c_h);
+          const unsigned char *r1 = y4m_clamped_row(tmp, y - 1, c_w, c_h);
+          const unsigned char *r2 = y4m_clamped_row(tmp, y, c_w, c_h);
+          const unsigned char *r3 = y4m_clamped_row(tmp, y + 1, c_w, c_h);
+          const unsigned char *r4 = y4m_clamped_row(tmp, y + 2, c_w, c_h);
+          const unsigned char *r5 = y4m_clamped_row(tmp, y + 3, c_w, c_h);
+          for (x = 0; x < c_w; x++) {
+            _dst[x] = (unsigned char)OC_CLAMPI(
                 0,
-                (4 * tmp[0] - 17 * tmp[OC_MAXI(y - 1, 0) * c_w] +
-                 114 * tmp[y * c_w] + 35 * tmp[OC_MINI(y + 1, c_h - 1) * c_w] -
-                 9 * tmp[OC_MINI(y + 2, c_h - 1) * c_w] +
-                 tmp[OC_MINI(y + 3, c_h - 1) * c_w] + 64) >>
+                (4 * r0[x] - 17 * r1[x] + 114 * r2[x] + 35 * r3[x] - 9 * r4[x] +
+                 r5[x] + 64) >>
                     7,
                 255);
           }
-          for (; y < c_h - 3; y++) {
-            _dst[y * c_w] = (unsigned char)OC_CLAMPI(
-                0,
-                (4 * tmp[(y - 2) * c_w] - 17 * tmp[(y - 1) * c_w] +
-                 114 * tmp[y * c_w] + 35 * tmp[(y + 1) * c_w] -
-                 9 * tmp[(y + 2) * c_w] + tmp[(y + 3) * c_w] + 64) >>
-                    7,
-                255);
-          }
-          for (; y < c_h; y++) {
-            _dst[y * c_w] = (unsigned char)OC_CLAMPI(
-                0,
-                (4 * tmp[(y - 2) * c_w] - 17 * tmp[(y - 1) * c_w] +
-                 114 * tmp[y * c_w] + 35 * tmp[OC_MINI(y + 1, c_h - 1) * c_w] -
-                 9 * tmp[OC_MINI(y + 2, c_h - 1) * c_w] + tmp[(c_h - 1) * c_w] +
-                 64) >>
-                    7,
-                255);
-          }
-          _dst++;
-          tmp++;
+          _dst += c_w;
         }
       } break;
     }
@@ -467,38 +441,23 @@ static void y4m_422jpeg_420jpeg_helper(unsigned char *_dst,
                                        int _c_h) {
   int y;
   int x;
-  /*Filter: [3 -17 78 78 -17 3]/128, derived from a 6-tap Lanczos window.*/
-  for (x = 0; x < _c_w; x++) {
-    for (y = 0; y < OC_MINI(_c_h, 2); y += 2) {
-      _dst[(y >> 1) * _c_w] =
-          OC_CLAMPI(0,
-                    (64 * _src[0] + 78 * _src[OC_MINI(1, _c_h - 1) * _c_w] -
-                     17 * _src[OC_MINI(2, _c_h - 1) * _c_w] +
-                     3 * _src[OC_MINI(3, _c_h - 1) * _c_w] + 64) >>
-                        7,
-                    255);
-    }
-    for (; y < _c_h - 3; y += 2) {
-      _dst[(y >> 1) * _c_w] =
-          OC_CLAMPI(0,
-                    (3 * (_src[(y - 2) * _c_w] + _src[(y + 3) * _c_w]) -
-                     17 * (_src[(y - 1) * _c_w] + _src[(y + 2) * _c_w]) +
-                     78 * (_src[y * _c_w] + _src[(y + 1) * _c_w]) + 64) >>
-                        7,
-                    255);
+  /*Filter: [3 -17 78 78 -17 3]/128, derived from a 6-tap Lanczos window.
+    Rows past the top and bottom edges are replaced by the edge rows.*/
+  for (y = 0; y < _c_h; y += 2) {
+    const unsigned char *r0 = y4m_clamped_row(_src, y - 2, _c_w, _c_h);
+    const unsigned char *r1 = y4m_clamped_row(_src, y - 1, _c_w, _c_h);
+    const unsigned char *r2 = y4m_clamped_row(_src, y, _c_w, _c_h);
+    const unsigned char *r3 = y4m_clamped_row(_src, y + 1, _c_w, _c_h);
+    const unsigned char *r4 = y4m_clamped_row(_src, y + 2, _c_w, _c_h);
+    const unsigned char *r5 = y4m_clamped_row(_src, y + 3, _c_w, _c_h);
+    for (x = 0; x < _c_w; x++) {
+      _dst[x] = OC_CLAMPI(0,
+                          (3 * (r0[x] + r5[x]) - 17 * (r1[x] + r4[x]) +
+                           78 * (r2[x] + r3[x]) + 64) >>
+                              7,
+                          255);
     }
-    for (; y < _c_h; y += 2) {
-      _dst[(y >> 1) * _c_w] = OC_CLAMPI(
-          0,
-          (3 * (_src[(y - 2) * _c_w] + _src[(_c_h - 1) * _c_w]) -
-           17 * (_src[(y - 1) * _c_w] + _src[OC_MINI(y + 2, _c_h - 1) * _c_w]) +
-           78 * (_src[y * _c_w] + _src[OC_MINI(y + 1, _c_h - 1) * _c_w]) +
-           64) >>
-              7,
-          255);
-    }
-    _src++;
-    _dst++;
+    _dst += _c_w;
   }
 }
 
@@ -13,6 +13,60 @@
 
 #include "aom/aom_image.h"
 #include "gtest/gtest.h"
+#include "test/acm_random.h"
+
+namespace {
+
+int GetSample(const aom_image_t *img, int plane, int x, int y) {
+  const int hbd = (img->fmt & AOM_IMG_FMT_HIGHBITDEPTH) != 0;
+  int step = 1;
+  const unsigned char *buf = img->planes[plane];
+  if (img->fmt == AOM_IMG_FMT_NV12 && plane > 0) {
+    step = 2;
+    buf = img->planes[AOM_PLANE_U] + (plane == AOM_PLANE_V);
+  }
+  const unsigned char *row = buf + y * img->stride[plane > 0 ? 1 : 0];
+  return hbd ? reinterpret_cast<const uint16_t *>(row)[x * step]
+             : row[x * step];
+}
+
+void FillRandom(aom_image_t *img, libaom_test::ACMRandom *rnd) {
+  const int mask = (1 << img->bit_depth) - 1;
+  for (int plane = 0; plane < 3; ++plane) {
+    unsigned char *row = img->planes[plane];
+    for (int y = 0; y < aom_img_plane_height(img, plane); ++y) {
+      for (int x = 0; x < aom_img_plane_width(img, plane); ++x) {
+        if (img->fmt & AOM_IMG_FMT_HIGHBITDEPTH)
+          reinterpret_cast<uint16_t *>(row)[x] = rnd->Rand16() & mask;
+        else
+          row[x] = rnd->Rand8();
+      }
+      row += img->stride[plane];
+    }
+  }
+}
+
+// Returns true if every sample of the two images is equal.
+bool SamplesEqual(const aom_image_t *a, const aom_image_t *b) {
+  for (int plane = 0; plane < 3; ++plane) {
+    for (int y = 0; y < aom_img_plane_height(a, plane); ++y) {
+      for (int x = 0; x < aom_img_plane_width(a, plane); ++x) {
+        if (GetSample(a, plane, x, y) != GetSample(b, plane, x, y))
+          return false;
+      }
+    }
+  }
+  return true;
+}
+
+aom_image_t *AllocImage(aom_img_fmt_t fmt, unsigned int bit_depth,
+                        unsigned int w, unsigned int h, unsigned int align) {
+  aom_image_t *img = aom_img_alloc(nullptr, fmt, w, h, align);
+  if (img) img->bit_depth = bit_depth;
+  return img;
+}
+
+}  // namespace
 
 TEST(AomImageTest, AomImgWrapInvalidAlign) {
   const int kWidth = 128;
@@ -135,3 +189,143 @@ TEST(AomImageTest, AomImgAllocHugeWidth) {
     aom_img_free(image);
   }
 }
+
+TEST(AomImageTest, AomImgConvertBitDepth) {
+  libaom_test::ACMRandom rnd(libaom_test::ACMRandom::DeterministicSeed());
+  aom_image_t *src = AllocImage(AOM_IMG_FMT_I420, 8, 67, 35, 1);
+  aom_image_t *hbd = AllocImage(AOM_IMG_FMT_I42016, 10, 67, 35, 32);
+  aom_image_t *dst = AllocImage(AOM_IMG_FMT_I420, 8, 67, 35, 16);
+  ASSERT_NE(src, nullptr);
+  ASSERT_NE(hbd, nullptr);
+  ASSERT_NE(dst, nullptr);
+  FillRandom(src, &rnd);
+
+  ASSERT_EQ(aom_img_convert(hbd, src, 3), 0);
+  for (int plane = 0; plane < 3; ++plane) {
+    for (int y = 0; y < aom_img_plane_height(src, plane); ++y) {
+      for (int x = 0; x < aom_img_plane_width(src, plane); ++x) {
+        ASSERT_EQ(GetSample(hbd, plane, x, y),
+                  GetSample(src, plane, x, y) << 2);
+      }
+    }
+  }
+  ASSERT_EQ(aom_img_convert(dst, hbd, 3), 0);
+  EXPECT_TRUE(SamplesEqual(src, dst));
+
+  aom_img_free(src);
+  aom_img_free(hbd);
+  aom_img_free(dst);
+}
+
+TEST(AomImageTest, AomImgConvertNv12) {
+  libaom_test::ACMRandom rnd(libaom_test::ACMRandom::DeterministicSeed());
+  aom_image_t *src = AllocImage(AOM_IMG_FMT_YV12, 8, 35, 19, 1);
+  aom_image_t *nv12 = AllocImage(AOM_IMG_FMT_NV12, 8, 35, 19, 32);
+  aom_image_t *dst = AllocImage(AOM_IMG_FMT_I420, 8, 35, 19, 1);
+  ASSERT_NE(src, nullptr);
+  ASSERT_NE(nv12, nullptr);
+  ASSERT_NE(dst, nullptr);
+  FillRandom(src, &rnd);
+
+  ASSERT_EQ(aom_img_convert(nv12, src, 2), 0);
+  EXPECT_TRUE(SamplesEqual(src, nv12));
+  EXPECT_EQ(nv12->planes[AOM_PLANE_U][1], src->planes[AOM_PLANE_V][0]);
+  ASSERT_EQ(aom_img_convert(dst, nv12, 2), 0);
+  EXPECT_TRUE(SamplesEqual(src, dst));
+
+  aom_img_free(src);
+  aom_img_free(nv12);
+  aom_img_free(dst);
+}
+
+TEST(AomImageTest, AomImgConvertSubsampling) {
+  libaom_test::ACMRandom rnd(libaom_test::ACMRandom::DeterministicSeed());
+  aom_image_t *src = AllocImage(AOM_IMG_FMT_I42016, 12, 37, 21, 1);
+  aom_image_t *i444 = AllocImage(AOM_IMG_FMT_I44416, 12, 37, 21, 1);
+  aom_image_t *dst = AllocImage(AOM_IMG_FMT_I42016, 12, 37, 21, 1);
+  ASSERT_NE(src, nullptr);
+  ASSERT_NE(i444, nullptr);
+  ASSERT_NE(dst, nullptr);
+  FillRandom(src, &rnd);
+
+  // Upsampling replicates the samples, so downsampling restores them.
+  ASSERT_EQ(aom_img_convert(i444, src, 1), 0);
+  EXPECT_EQ(GetSample(i444, AOM_PLANE_U, 36, 20),
+            GetSample(src, AOM_PLANE_U, 18, 10));
+  ASSERT_EQ(aom_img_convert(dst, i444, 1), 0);
+  EXPECT_TRUE(SamplesEqual(src, dst));
+
+  FillRandom(i444, &rnd);
+  ASSERT_EQ(aom_img_convert(dst, i444, 1), 0);
+  const int sum = GetSample(i444, AOM_PLANE_V, 2, 4) +
+                  GetSample(i444, AOM_PLANE_V, 3, 4) +
+                  GetSample(i444, AOM_PLANE_V, 2, 5) +
+                  GetSample(i444, AOM_PLANE_V, 3, 5);
+  EXPECT_EQ(GetSample(dst, AOM_PLANE_V, 1, 2), (sum + 2) >> 2);
+  // The last column and row have no neighbor to average with.
+  EXPECT_EQ(GetSample(dst, AOM_PLANE_U, 18, 10),
+            GetSample(i444, AOM_PLANE_U, 36, 20));
+
+  aom_img_free(src);
+  aom_img_free(i444);
+  aom_img_free(dst);
+}
+
+TEST(AomImageTest, AomImgConvertThreads) {
+  libaom_test::ACMRandom rnd(libaom_test::ACMRandom::DeterministicSeed());
+  aom_image_t *src = AllocImage(AOM_IMG_FMT_I44416, 12, 97, 45, 1);
+  aom_image_t *ref = AllocImage(AOM_IMG_FMT_I420, 8, 97, 45, 1);
+  aom_image_t *dst = AllocImage(AOM_IMG_FMT_I420, 8, 97, 45, 1);
+  ASSERT_NE(src, nullptr);
+  ASSERT_NE(ref, nullptr);
+  ASSERT_NE(dst, nullptr);
+  FillRandom(src, &rnd);
+
+  ASSERT_EQ(aom_img_convert(ref, src, 1), 0);
+  for (int num_threads : { 2, 3, 8, 100 }) {
+    ASSERT_EQ(aom_img_convert(dst, src, num_threads), 0);
+    EXPECT_TRUE(SamplesEqual(ref, dst)) << num_threads << " threads";
+  }
+
+  aom_img_free(src);
+  aom_img_free(ref);
+  aom_img_free(dst);
+}
+
+TEST(AomImageTest, AomImgConvertMonochrome) {
+  libaom_test::ACMRandom rnd(libaom_test::ACMRandom::DeterministicSeed());
+  aom_image_t *src = AllocImage(AOM_IMG_FMT_I420, 8, 16, 16, 1);
+  aom_image_t *dst = AllocImage(AOM_IMG_FMT_I44416, 10, 16, 16, 1);
+  ASSERT_NE(src, nullptr);
+  ASSERT_NE(dst, nullptr);
+  FillRandom(src, &rnd);
+  src->monochrome = 1;
+
+  ASSERT_EQ(aom_img_convert(dst, src, 1), 0);
+  for (int plane = 1; plane < 3; ++plane) {
+    for (int y = 0; y < 16; ++y) {
+      for (int x = 0; x < 16; ++x) {
+        ASSERT_EQ(GetSample(dst, plane, x, y), 512);
+      }
+    }
+  }
+
+  aom_img_free(src);
+  aom_img_free(dst);
+}
+
+TEST(AomImageTest, AomImgConvertUnsupported) {
+  aom_image_t *src = AllocImage(AOM_IMG_FMT_I420, 8, 16, 16, 1);
+  aom_image_t *dst = AllocImage(AOM_IMG_FMT_I420, 8, 16, 16, 1);
+  ASSERT_NE(src, nullptr);
+  ASSERT_NE(dst, nullptr);
+  dst->d_h = 8;
+  EXPECT_EQ(aom_img_convert(dst, src, 1), -1);
+  dst->d_h = 16;
+  EXPECT_EQ(aom_img_convert(dst, src, 1), 0);
+  src->bit_depth = 10;
+  EXPECT_EQ(aom_img_convert(dst, src, 1), -1);
+
+  aom_img_free(src);
+  aom_img_free(dst);
+}
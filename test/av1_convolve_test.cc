@@ -1338,6 +1338,86 @@ INSTANTIATE_TEST_SUITE_P(SVE2, AV1Convolve2DTest,
                          BuildLowbdParams(av1_convolve_2d_sr_sve2));
 #endif
 
+//////////////////////////////////////////////////////////////////////
+// Two-pass convolve-2D functions used for caching (low bit-depth)
+//////////////////////////////////////////////////////////////////////
+typedef void (*convolve_2d_horiz_func)(
+    const uint8_t *src, int src_stride, int16_t *im_block, int w, int h,
+    const InterpFilterParams *filter_params_x, const int subpel_x_qn,
+    ConvolveParams *conv_params);
+typedef void (*convolve_2d_vert_func)(const int16_t *im_block, uint8_t *dst,
+                                      int dst_stride, int w, int h,
+                                      const InterpFilterParams *filter_params_y,
+                                      const int subpel_y_qn,
+                                      ConvolveParams *conv_params);
+
+// Runs the horizontal and vertical passes back to back, so that the pair can
+// be checked against av1_convolve_2d_sr_c().
+template <convolve_2d_horiz_func horiz, convolve_2d_vert_func vert>
+void Convolve2DTwoPass(const uint8_t *src, int src_stride, uint8_t *dst,
+                       int dst_stride, int w, int h,
+                       const InterpFilterParams *filter_params_x,
+                       const InterpFilterParams *filter_params_y,
+                       const int subpel_x_qn, const int subpel_y_qn,
+                       ConvolveParams *conv_params) {
+  DECLARE_ALIGNED(32, int16_t, im_block[CONVOLVE_2D_SR_IM_BLOCK_SIZE]);
+  horiz(src, src_stride, im_block, w, h, filter_params_x, subpel_x_qn,
+        conv_params);
+  vert(im_block, dst, dst_stride, w, h, filter_params_y, subpel_y_qn,
+       conv_params);
+}
+
+class AV1Convolve2DTwoPassTest : public AV1ConvolveTest<convolve_2d_func> {
+ public:
+  void RunTest() {
+    const int width = GetParam().Block().Width();
+    const int height = GetParam().Block().Height();
+    const uint8_t *input = FirstRandomInput8(GetParam());
+    // Only the 8-tap switchable filters are supported.
+    for (int sub_x = 1; sub_x < 16; ++sub_x) {
+      for (int sub_y = 1; sub_y < 16; ++sub_y) {
+        for (int h_f = EIGHTTAP_REGULAR; h_f <= BILINEAR; ++h_f) {
+          for (int v_f = EIGHTTAP_REGULAR; v_f <= BILINEAR; ++v_f) {
+            const InterpFilterParams *filter_params_x =
+                av1_get_interp_filter_params_with_block_size(
+                    static_cast<InterpFilter>(h_f), width);
+            const InterpFilterParams *filter_params_y =
+                av1_get_interp_filter_params_with_block_size(
+                    static_cast<InterpFilter>(v_f), height);
+            DECLARE_ALIGNED(32, uint8_t, reference[MAX_SB_SQUARE]);
+            ConvolveParams conv_params1 =
+                get_conv_params_no_round(0, 0, nullptr, 0, 0, 8);
+            av1_convolve_2d_sr_c(input, width, reference, kOutputStride, width,
+                                 height, filter_params_x, filter_params_y,
+                                 sub_x, sub_y, &conv_params1);
+            DECLARE_ALIGNED(32, uint8_t, test[MAX_SB_SQUARE]);
+            ConvolveParams conv_params2 =
+                get_conv_params_no_round(0, 0, nullptr, 0, 0, 8);
+            GetParam().TestFunction()(input, width, test, kOutputStride, width,
+                                      height, filter_params_x, filter_params_y,
+                                      sub_x, sub_y, &conv_params2);
+            AssertOutputBufferEq(reference, test, width, height);
+          }
+        }
+      }
+    }
+  }
+};
+
+TEST_P(AV1Convolve2DTwoPassTest, RunTest) { RunTest(); }
+
+INSTANTIATE_TEST_SUITE_P(
+    C, AV1Convolve2DTwoPassTest,
+    BuildLowbdParams(Convolve2DTwoPass<av1_convolve_2d_sr_horiz_c,
+                                       av1_convolve_2d_sr_vert_c>));
+
+#if HAVE_AVX2
+INSTANTIATE_TEST_SUITE_P(
+    AVX2, AV1Convolve2DTwoPassTest,
+    BuildLowbdParams(Convolve2DTwoPass<av1_convolve_2d_sr_horiz_avx2,
+                                       av1_convolve_2d_sr_vert_avx2>));
+#endif
+
 /////////////////////////////////////////////////////////////////
 // Single reference convolve-2D IntraBC functions (low bit-depth)
 /////////////////////////////////////////////////////////////////
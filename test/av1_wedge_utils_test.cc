@@ -9,6 +9,8 @@
  * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
  */
 
+#include <memory>
+
 #include "gtest/gtest.h"
 
 #include "config/aom_config.h"
@@ -357,6 +359,134 @@ TEST_P(WedgeUtilsDeltaSquaresOptTest, RandomValues) {
   }
 }
 
+//////////////////////////////////////////////////////////////////////////////
+// av1_wedge_{sse,sign}_from_residuals_multi
+//////////////////////////////////////////////////////////////////////////////
+
+static const int kMaxMasks = 16;  // MAX_WEDGE_TYPES
+
+typedef void (*FSSEMulti)(const int16_t *r1, const int16_t *d,
+                          const uint8_t *const *masks, int num_masks, int N,
+                          uint64_t *sse);
+typedef libaom_test::FuncParam<FSSEMulti> TestFuncsFSSEMulti;
+
+class WedgeUtilsSSEMultiOptTest : public FunctionEquivalenceTest<FSSEMulti> {
+ protected:
+  static const int kIterations = 1000;
+};
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(WedgeUtilsSSEMultiOptTest);
+
+TEST_P(WedgeUtilsSSEMultiOptTest, RandomValues) {
+  DECLARE_ALIGNED(32, int16_t, r1[MAX_SB_SQUARE]);
+  DECLARE_ALIGNED(32, int16_t, d[MAX_SB_SQUARE]);
+  std::unique_ptr<uint8_t[]> m_buf(new uint8_t[kMaxMasks * MAX_SB_SQUARE]);
+  uint8_t *m[kMaxMasks];
+  const uint8_t *masks[kMaxMasks];
+  uint64_t ref_res[kMaxMasks];
+  uint64_t tst_res[kMaxMasks];
+
+  for (int k = 0; k < kMaxMasks; ++k) {
+    m[k] = m_buf.get() + k * MAX_SB_SQUARE;
+    masks[k] = m[k];
+  }
+
+  for (int iter = 0; iter < kIterations && !HasFatalFailure(); ++iter) {
+    const int extreme = rng_(4) == 0;
+    for (int i = 0; i < MAX_SB_SQUARE; ++i) {
+      if (extreme) {
+        r1[i] = rng_(2) ? kInt13Max : -kInt13Max;
+        d[i] = rng_(2) ? kInt13Max : -kInt13Max;
+      } else {
+        r1[i] = rng_(2 * kInt13Max + 1) - kInt13Max;
+        d[i] = rng_(2 * kInt13Max + 1) - kInt13Max;
+      }
+      for (int k = 0; k < kMaxMasks; ++k) m[k][i] = rng_(MAX_MASK_VALUE + 1);
+    }
+
+    const int N = 64 * (rng_(MAX_SB_SQUARE / 64) + 1);
+    const int num_masks = rng_(kMaxMasks) + 1;
+
+    params_.ref_func(r1, d, masks, num_masks, N, ref_res);
+    API_REGISTER_STATE_CHECK(
+        params_.tst_func(r1, d, masks, num_masks, N, tst_res));
+
+    for (int k = 0; k < num_masks; ++k) {
+      ASSERT_EQ(ref_res[k], tst_res[k]) << "mask " << k;
+      ASSERT_EQ(ref_res[k], av1_wedge_sse_from_residuals_c(r1, d, m[k], N))
+          << "mask " << k;
+    }
+  }
+}
+
+typedef void (*FSignMulti)(const int16_t *ds, const uint8_t *const *masks,
+                           int num_masks, int N, int64_t limit, int8_t *signs);
+typedef libaom_test::FuncParam<FSignMulti> TestFuncsFSignMulti;
+
+class WedgeUtilsSignMultiOptTest : public FunctionEquivalenceTest<FSignMulti> {
+ protected:
+  static const int kIterations = 1000;
+  static const int kMaxSize = 8196;  // Size limited by SIMD implementation.
+};
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(WedgeUtilsSignMultiOptTest);
+
+TEST_P(WedgeUtilsSignMultiOptTest, RandomValues) {
+  DECLARE_ALIGNED(32, int16_t, r0[MAX_SB_SQUARE]);
+  DECLARE_ALIGNED(32, int16_t, r1[MAX_SB_SQUARE]);
+  DECLARE_ALIGNED(32, int16_t, ds[MAX_SB_SQUARE]);
+  std::unique_ptr<uint8_t[]> m_buf(new uint8_t[kMaxMasks * MAX_SB_SQUARE]);
+  uint8_t *m[kMaxMasks];
+  const uint8_t *masks[kMaxMasks];
+  int8_t ref_res[kMaxMasks];
+  int8_t tst_res[kMaxMasks];
+
+  for (int k = 0; k < kMaxMasks; ++k) {
+    m[k] = m_buf.get() + k * MAX_SB_SQUARE;
+    masks[k] = m[k];
+  }
+
+  for (int iter = 0; iter < kIterations && !HasFatalFailure(); ++iter) {
+    for (int i = 0; i < MAX_SB_SQUARE; ++i) {
+      r0[i] = rng_(2 * kInt13Max + 1) - kInt13Max;
+      r1[i] = rng_(2 * kInt13Max + 1) - kInt13Max;
+      for (int k = 0; k < kMaxMasks; ++k) m[k][i] = rng_(MAX_MASK_VALUE + 1);
+    }
+
+    const int maxN = AOMMIN(kMaxSize, MAX_SB_SQUARE);
+    const int N = 64 * (rng_(maxN / 64 - 1) + 1);
+    const int num_masks = rng_(kMaxMasks) + 1;
+
+    int64_t limit;
+    limit = (int64_t)aom_sum_squares_i16(r0, N);
+    limit -= (int64_t)aom_sum_squares_i16(r1, N);
+    limit *= (1 << WEDGE_WEIGHT_BITS) / 2;
+
+    for (int i = 0; i < N; i++)
+      ds[i] = clamp(r0[i] * r0[i] - r1[i] * r1[i], INT16_MIN, INT16_MAX);
+
+    params_.ref_func(ds, masks, num_masks, N, limit, ref_res);
+    API_REGISTER_STATE_CHECK(
+        params_.tst_func(ds, masks, num_masks, N, limit, tst_res));
+
+    for (int k = 0; k < num_masks; ++k) {
+      ASSERT_EQ(ref_res[k], tst_res[k]) << "mask " << k;
+      ASSERT_EQ(ref_res[k], av1_wedge_sign_from_residuals_c(ds, m[k], N, limit))
+          << "mask " << k;
+    }
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    C, WedgeUtilsSSEMultiOptTest,
+    ::testing::Values(TestFuncsFSSEMulti(
+        av1_wedge_sse_from_residuals_multi_c,
+        av1_wedge_sse_from_residuals_multi_c)));
+
+INSTANTIATE_TEST_SUITE_P(
+    C, WedgeUtilsSignMultiOptTest,
+    ::testing::Values(TestFuncsFSignMulti(
+        av1_wedge_sign_from_residuals_multi_c,
+        av1_wedge_sign_from_residuals_multi_c)));
+
 #if HAVE_SSE2
 INSTANTIATE_TEST_SUITE_P(
     SSE2, WedgeUtilsSSEOptTest,
@@ -406,6 +536,18 @@ INSTANTIATE_TEST_SUITE_P(
     AVX2, WedgeUtilsDeltaSquaresOptTest,
     ::testing::Values(TestFuncsFDS(av1_wedge_compute_delta_squares_sse2,
                                    av1_wedge_compute_delta_squares_avx2)));
+
+INSTANTIATE_TEST_SUITE_P(
+    AVX2, WedgeUtilsSSEMultiOptTest,
+    ::testing::Values(TestFuncsFSSEMulti(
+        av1_wedge_sse_from_residuals_multi_c,
+        av1_wedge_sse_from_residuals_multi_avx2)));
+
+INSTANTIATE_TEST_SUITE_P(
+    AVX2, WedgeUtilsSignMultiOptTest,
+    ::testing::Values(TestFuncsFSignMulti(
+        av1_wedge_sign_from_residuals_multi_c,
+        av1_wedge_sign_from_residuals_multi_avx2)));
 #endif  // HAVE_AVX2
 
 #if HAVE_SVE
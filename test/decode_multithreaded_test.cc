@@ -18,7 +18,7 @@
 #include "test/codec_factory.h"
 #include "test/encode_test_driver.h"
 #include "test/i420_video_source.h"
-#include "test/md5_helper.h"
+#include "test/xxhash_helper.h"
 #include "test/util.h"
 
 namespace {
@@ -30,10 +30,10 @@ class AV1DecodeMultiThreadedTest
       public ::libaom_test::EncoderTest {
  protected:
   AV1DecodeMultiThreadedTest()
-      : EncoderTest(GET_PARAM(0)), md5_single_thread_(), md5_multi_thread_(),
-        n_tile_cols_(GET_PARAM(1)), n_tile_rows_(GET_PARAM(2)),
-        n_tile_groups_(GET_PARAM(3)), set_cpu_used_(GET_PARAM(4)),
-        row_mt_(GET_PARAM(5)) {
+      : EncoderTest(GET_PARAM(0)), hash_single_thread_(),
+        hash_multi_thread_(), n_tile_cols_(GET_PARAM(1)),
+        n_tile_rows_(GET_PARAM(2)), n_tile_groups_(GET_PARAM(3)),
+        set_cpu_used_(GET_PARAM(4)), row_mt_(GET_PARAM(5)) {
     init_flags_ = AOM_CODEC_USE_PSNR;
     aom_codec_dec_cfg_t cfg = aom_codec_dec_cfg_t();
     cfg.w = 704;
@@ -81,8 +81,8 @@ class AV1DecodeMultiThreadedTest
     }
   }
 
-  void UpdateMD5(::libaom_test::Decoder *dec, const aom_codec_cx_pkt_t *pkt,
-                 ::libaom_test::MD5 *md5) {
+  void UpdateHash(::libaom_test::Decoder *dec, const aom_codec_cx_pkt_t *pkt,
+                  ::libaom_test::XXH64 *hash) {
     const aom_codec_err_t res = dec->DecodeFrame(
         reinterpret_cast<uint8_t *>(pkt->data.frame.buf), pkt->data.frame.sz);
     if (res != AOM_CODEC_OK) {
@@ -90,14 +90,14 @@ class AV1DecodeMultiThreadedTest
       ASSERT_EQ(AOM_CODEC_OK, res);
     }
     const aom_image_t *img = dec->GetDxData().Next();
-    md5->Add(img);
+    hash->Add(img);
   }
 
   void FramePktHook(const aom_codec_cx_pkt_t *pkt) override {
-    UpdateMD5(single_thread_dec_, pkt, &md5_single_thread_);
+    UpdateHash(single_thread_dec_, pkt, &hash_single_thread_);
 
     for (int i = 0; i < kNumMultiThreadDecoders; ++i)
-      UpdateMD5(multi_thread_dec_[i], pkt, &md5_multi_thread_[i]);
+      UpdateHash(multi_thread_dec_[i], pkt, &hash_multi_thread_[i]);
   }
 
   void DoTest() {
@@ -111,16 +111,16 @@ class AV1DecodeMultiThreadedTest
                                        timebase.den, timebase.num, 0, 2);
     ASSERT_NO_FATAL_FAILURE(RunLoop(&video));
 
-    const char *md5_single_thread_str = md5_single_thread_.Get();
+    const char *hash_single_thread_str = hash_single_thread_.Get();
 
     for (int i = 0; i < kNumMultiThreadDecoders; ++i) {
-      const char *md5_multi_thread_str = md5_multi_thread_[i].Get();
-      ASSERT_STREQ(md5_single_thread_str, md5_multi_thread_str);
+      const char *hash_multi_thread_str = hash_multi_thread_[i].Get();
+      ASSERT_STREQ(hash_single_thread_str, hash_multi_thread_str);
     }
   }
 
-  ::libaom_test::MD5 md5_single_thread_;
-  ::libaom_test::MD5 md5_multi_thread_[kNumMultiThreadDecoders];
+  ::libaom_test::XXH64 hash_single_thread_;
+  ::libaom_test::XXH64 hash_multi_thread_[kNumMultiThreadDecoders];
   ::libaom_test::Decoder *single_thread_dec_;
   ::libaom_test::Decoder *multi_thread_dec_[kNumMultiThreadDecoders];
 
@@ -133,7 +133,7 @@ class AV1DecodeMultiThreadedTest
 };
 
 // run an encode and do the decode both in single thread
-// and multi thread. Ensure that the MD5 of the output in both cases
+// and multi thread. Ensure that the hash of the output in both cases
 // is identical. If so, the test passes.
 TEST_P(AV1DecodeMultiThreadedTest, MD5Match) {
   cfg_.large_scale_tile = 0;
@@ -143,6 +143,19 @@ TEST_P(AV1DecodeMultiThreadedTest, MD5Match) {
   DoTest();
 }
 
+// Same as above, but with superres enabled on every frame, so that the
+// multi-threaded superres upscaling is exercised before loop restoration.
+TEST_P(AV1DecodeMultiThreadedTest, SuperresMD5Match) {
+  cfg_.large_scale_tile = 0;
+  cfg_.rc_superres_mode = AOM_SUPERRES_FIXED;
+  cfg_.rc_superres_denominator = 13;
+  cfg_.rc_superres_kf_denominator = 11;
+  single_thread_dec_->Control(AV1_SET_TILE_MODE, 0);
+  for (int i = 0; i < kNumMultiThreadDecoders; ++i)
+    multi_thread_dec_[i]->Control(AV1_SET_TILE_MODE, 0);
+  DoTest();
+}
+
 class AV1DecodeMultiThreadedTestLarge : public AV1DecodeMultiThreadedTest {};
 
 TEST_P(AV1DecodeMultiThreadedTestLarge, MD5Match) {
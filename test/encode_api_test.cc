@@ -651,6 +651,38 @@ TEST(EncodeAPI, PtsOrDurationTooBig) {
   aom_codec_destroy(&enc);
 }
 
+TEST(EncodeAPI, ScaleInput) {
+  aom_codec_iface_t *const iface = aom_codec_av1_cx();
+  aom_codec_ctx_t enc;
+  aom_codec_enc_cfg_t cfg;
+
+  ASSERT_EQ(aom_codec_enc_config_default(iface, &cfg, AOM_USAGE_REALTIME),
+            AOM_CODEC_OK);
+  cfg.g_w = 320;
+  cfg.g_h = 180;
+  ASSERT_EQ(aom_codec_enc_init(&enc, iface, &cfg, 0), AOM_CODEC_OK);
+  ASSERT_EQ(aom_codec_control(&enc, AOME_SET_CPUUSED, 10), AOM_CODEC_OK);
+
+  aom_image_t *const image = CreateGrayImage(AOM_IMG_FMT_I420, 641, 359);
+  ASSERT_NE(image, nullptr);
+
+  // Without input scaling the image size must match the configuration.
+  ASSERT_EQ(aom_codec_encode(&enc, image, 0, 1, 0), AOM_CODEC_INVALID_PARAM);
+
+  ASSERT_EQ(aom_codec_control(&enc, AV1E_SET_SCALE_INPUT, 1u), AOM_CODEC_OK);
+  for (int i = 0; i < 2; ++i) {
+    ASSERT_EQ(aom_codec_encode(&enc, image, i, 1, 0), AOM_CODEC_OK);
+    aom_image_t recon;
+    ASSERT_EQ(aom_codec_control(&enc, AV1_GET_NEW_FRAME_IMAGE, &recon),
+              AOM_CODEC_OK);
+    EXPECT_EQ(recon.d_w, cfg.g_w);
+    EXPECT_EQ(recon.d_h, cfg.g_h);
+  }
+
+  aom_img_free(image);
+  ASSERT_EQ(aom_codec_destroy(&enc), AOM_CODEC_OK);
+}
+
 // Reproduces https://crbug.com/339877165.
 TEST(EncodeAPI, Buganizer339877165) {
   // Initialize libaom encoder.
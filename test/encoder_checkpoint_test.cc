@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2024, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "aom/aomcx.h"
+#include "aom/aom_encoder.h"
+#include "aom/aom_image.h"
+#include "test/acm_random.h"
+#include "test/xxhash_helper.h"
+
+namespace {
+
+constexpr int kWidth = 176;
+constexpr int kHeight = 144;
+constexpr int kNumFrames = 26;
+constexpr int kKeyFrameInterval = 9;
+
+// Fills img with a textured background panning by one pixel per frame and a
+// block moving across it, with a scene cut halfway through.
+void FillFrame(aom_image_t *img, int frame) {
+  libaom_test::ACMRandom rnd(libaom_test::ACMRandom::DeterministicSeed());
+  const int scene = frame >= kNumFrames / 2;
+  for (int y = 0; y < kHeight; ++y) {
+    uint8_t *row = img->planes[AOM_PLANE_Y] + y * img->stride[AOM_PLANE_Y];
+    for (int x = 0; x < kWidth; ++x) {
+      const int tex = ((x + frame) * (y + 3 * scene + 1)) & 0x3f;
+      row[x] = static_cast<uint8_t>(64 + tex + (rnd.Rand8() & 0xf));
+    }
+  }
+  const int block_x = (frame * 4) % (kWidth - 24);
+  for (int y = 40; y < 64; ++y) {
+    uint8_t *row = img->planes[AOM_PLANE_Y] + y * img->stride[AOM_PLANE_Y];
+    for (int x = block_x; x < block_x + 24; ++x) row[x] = 220;
+  }
+  for (int plane = AOM_PLANE_U; plane <= AOM_PLANE_V; ++plane) {
+    for (int y = 0; y < kHeight / 2; ++y) {
+      uint8_t *row = img->planes[plane] + y * img->stride[plane];
+      memset(row, 112 + plane * 8 + scene * 16, kWidth / 2);
+    }
+  }
+}
+
+class EncoderCheckpointTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    ASSERT_NE(aom_img_alloc(&img_, AOM_IMG_FMT_I420, kWidth, kHeight, 1),
+              nullptr);
+    ASSERT_EQ(aom_codec_enc_config_default(aom_codec_av1_cx(), &cfg_,
+                                           AOM_USAGE_GOOD_QUALITY),
+              AOM_CODEC_OK);
+    cfg_.g_w = kWidth;
+    cfg_.g_h = kHeight;
+    cfg_.g_threads = 1;
+    cfg_.rc_end_usage = AOM_VBR;
+    cfg_.rc_target_bitrate = 300;
+    cfg_.kf_min_dist = kKeyFrameInterval;
+    cfg_.kf_max_dist = kKeyFrameInterval;
+  }
+
+  void TearDown() override { aom_img_free(&img_); }
+
+  void InitEncoder(aom_codec_ctx_t *enc) {
+    ASSERT_EQ(aom_codec_enc_init(enc, aom_codec_av1_cx(), &cfg_, 0),
+              AOM_CODEC_OK);
+    ASSERT_EQ(aom_codec_control(enc, AOME_SET_CPUUSED, 6), AOM_CODEC_OK);
+  }
+
+  // Encodes frames [first_frame, kNumFrames) and appends the hash of each
+  // packet to hashes. When checkpoint is not null, saves a checkpoint at the
+  // first key frame boundary after the start and sets checkpoint_frame to the
+  // number of frames whose packets had been returned at that point.
+  void Encode(aom_codec_ctx_t *enc, int first_frame,
+              std::vector<std::string> *hashes, aom_fixed_buf_t *checkpoint,
+              int *checkpoint_frame) {
+    int frames_out = first_frame;
+    for (int frame = first_frame; frame <= kNumFrames; ++frame) {
+      aom_image_t *const raw = frame < kNumFrames ? &img_ : nullptr;
+      if (raw != nullptr) FillFrame(raw, frame);
+      ASSERT_EQ(aom_codec_encode(enc, raw, frame, 1, 0), AOM_CODEC_OK);
+      // A null image flushes one frame at a time, so keep flushing until the
+      // encoder has nothing left.
+      bool got_data;
+      do {
+        got_data = false;
+        aom_codec_iter_t iter = nullptr;
+        const aom_codec_cx_pkt_t *pkt;
+        while ((pkt = aom_codec_get_cx_data(enc, &iter)) != nullptr) {
+          got_data = true;
+          if (pkt->kind == AOM_CODEC_STATS_PKT) {
+            const uint8_t *const buf =
+                static_cast<const uint8_t *>(pkt->data.twopass_stats.buf);
+            stats_.insert(stats_.end(), buf, buf + pkt->data.twopass_stats.sz);
+            continue;
+          }
+          if (pkt->kind != AOM_CODEC_CX_FRAME_PKT) continue;
+          libaom_test::XXH64 hash;
+          hash.Add(static_cast<const uint8_t *>(pkt->data.frame.buf),
+                   pkt->data.frame.sz);
+          hashes->push_back(hash.Get());
+          ++frames_out;
+        }
+        if (checkpoint != nullptr && checkpoint->buf == nullptr &&
+            frames_out > 0 &&
+            aom_codec_control(enc, AV1E_GET_CHECKPOINT, checkpoint) ==
+                AOM_CODEC_OK) {
+          *checkpoint_frame = frames_out;
+        }
+        if (raw == nullptr && got_data) {
+          ASSERT_EQ(aom_codec_encode(enc, nullptr, frame, 1, 0), AOM_CODEC_OK);
+        }
+      } while (raw == nullptr && got_data);
+    }
+  }
+
+  void RunFirstPass() {
+    cfg_.g_pass = AOM_RC_FIRST_PASS;
+    aom_codec_ctx_t enc;
+    InitEncoder(&enc);
+    std::vector<std::string> hashes;
+    Encode(&enc, 0, &hashes, nullptr, nullptr);
+    EXPECT_EQ(aom_codec_destroy(&enc), AOM_CODEC_OK);
+    cfg_.g_pass = AOM_RC_LAST_PASS;
+    cfg_.rc_twopass_stats_in.buf = stats_.data();
+    cfg_.rc_twopass_stats_in.sz = stats_.size();
+  }
+
+  aom_image_t img_;
+  aom_codec_enc_cfg_t cfg_;
+  std::vector<uint8_t> stats_;
+};
+
+TEST_F(EncoderCheckpointTest, ResumeIsBitExact) {
+  ASSERT_NO_FATAL_FAILURE(RunFirstPass());
+
+  aom_codec_ctx_t enc;
+  ASSERT_NO_FATAL_FAILURE(InitEncoder(&enc));
+  std::vector<std::string> full_hashes;
+  aom_fixed_buf_t checkpoint = { nullptr, 0 };
+  int checkpoint_frame = 0;
+  ASSERT_NO_FATAL_FAILURE(
+      Encode(&enc, 0, &full_hashes, &checkpoint, &checkpoint_frame));
+  EXPECT_EQ(aom_codec_destroy(&enc), AOM_CODEC_OK);
+  ASSERT_EQ(full_hashes.size(), static_cast<size_t>(kNumFrames));
+  ASSERT_NE(checkpoint.buf, nullptr);
+  EXPECT_EQ(checkpoint_frame, kKeyFrameInterval);
+
+  ASSERT_NO_FATAL_FAILURE(InitEncoder(&enc));
+  ASSERT_EQ(aom_codec_control(&enc, AV1E_SET_CHECKPOINT, &checkpoint),
+            AOM_CODEC_OK);
+  std::vector<std::string> resumed_hashes;
+  ASSERT_NO_FATAL_FAILURE(
+      Encode(&enc, checkpoint_frame, &resumed_hashes, nullptr, nullptr));
+  EXPECT_EQ(aom_codec_destroy(&enc), AOM_CODEC_OK);
+  free(checkpoint.buf);
+
+  const std::vector<std::string> expected(
+      full_hashes.begin() + checkpoint_frame, full_hashes.end());
+  EXPECT_EQ(resumed_hashes, expected);
+}
+
+TEST_F(EncoderCheckpointTest, OnlyAtKeyFrameBoundaries) {
+  aom_codec_ctx_t enc;
+  aom_fixed_buf_t checkpoint = { nullptr, 0 };
+
+  // One-pass encodes do not support checkpoints.
+  ASSERT_NO_FATAL_FAILURE(InitEncoder(&enc));
+  EXPECT_EQ(aom_codec_control(&enc, AV1E_GET_CHECKPOINT, &checkpoint),
+            AOM_CODEC_INCAPABLE);
+  EXPECT_EQ(aom_codec_destroy(&enc), AOM_CODEC_OK);
+
+  ASSERT_NO_FATAL_FAILURE(RunFirstPass());
+  ASSERT_NO_FATAL_FAILURE(InitEncoder(&enc));
+  // Nothing has been coded yet.
+  EXPECT_EQ(aom_codec_control(&enc, AV1E_GET_CHECKPOINT, &checkpoint),
+            AOM_CODEC_ERROR);
+  EXPECT_EQ(aom_codec_control(&enc, AV1E_SET_CHECKPOINT, nullptr),
+            AOM_CODEC_INVALID_PARAM);
+  EXPECT_EQ(aom_codec_control(&enc, AV1E_SET_CHECKPOINT, &checkpoint),
+            AOM_CODEC_INVALID_PARAM);
+  EXPECT_EQ(checkpoint.buf, nullptr);
+  EXPECT_EQ(aom_codec_destroy(&enc), AOM_CODEC_OK);
+}
+
+}  // namespace
@@ -138,4 +138,43 @@ INSTANTIATE_TEST_SUITE_P(
                        ::testing::ValuesIn(kValidBlockSize)));
 #endif
 
+// The in-place hashes of 2x2 blocks and hash words must match hashing the
+// gathered bytes, which is how the IntraBC hash values are defined.
+TEST(AV1CrcHashTest, BlockHashMatchesGathered) {
+  libaom_test::ACMRandom rnd(libaom_test::ACMRandom::DeterministicSeed());
+  CRC_CALCULATOR *calc = new (std::nothrow) CRC_CALCULATOR;
+  ASSERT_NE(calc, nullptr);
+  const uint32_t polys[] = { 0x5D6DCB, 0x864CFB };
+  const int stride = 5;
+  for (uint32_t poly : polys) {
+    av1_crc_calculator_init(calc, 24, poly);
+    for (int i = 0; i < 1000; ++i) {
+      uint8_t pixels[2 * stride];
+      uint16_t pixels16[2 * stride];
+      for (int j = 0; j < 2 * stride; ++j) {
+        pixels[j] = rnd.Rand8();
+        pixels16[j] = rnd.Rand16();
+      }
+      uint8_t bytes[4] = { pixels[0], pixels[1], pixels[stride],
+                           pixels[stride + 1] };
+      ASSERT_EQ(av1_get_crc_value_2x2(calc, pixels, stride),
+                av1_get_crc_value(calc, bytes, sizeof(bytes)));
+
+      uint16_t shorts[4] = { pixels16[0], pixels16[1], pixels16[stride],
+                             pixels16[stride + 1] };
+      ASSERT_EQ(av1_get_crc_value_2x2_highbd(calc, pixels16, stride),
+                av1_get_crc_value(calc, reinterpret_cast<uint8_t *>(shorts),
+                                  sizeof(shorts)));
+
+      uint32_t words[4];
+      for (uint32_t &w : words) w = rnd.Rand31() ^ (rnd.Rand8() << 24);
+      ASSERT_EQ(av1_get_crc_value_u32x4(calc, words[0], words[1], words[2],
+                                        words[3]),
+                av1_get_crc_value(calc, reinterpret_cast<uint8_t *>(words),
+                                  sizeof(words)));
+    }
+  }
+  delete calc;
+}
+
 }  // namespace
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2024, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include <cstddef>
+#include <tuple>
+#include <vector>
+
+#include "config/aom_dsp_rtcd.h"
+
+#include "gtest/gtest.h"
+#include "test/acm_random.h"
+
+namespace {
+
+template <typename SrcT, typename DstT>
+class ImageShiftTest
+    : public ::testing::TestWithParam<std::tuple<
+          void (*)(const SrcT *, ptrdiff_t, DstT *, ptrdiff_t, int, int, int),
+          void (*)(const SrcT *, ptrdiff_t, DstT *, ptrdiff_t, int, int, int),
+          int>> {
+ protected:
+  // Compares the whole destination buffers, so that writes past the width of
+  // a row are also caught.
+  void RunCheckOutput() {
+    libaom_test::ACMRandom rnd(libaom_test::ACMRandom::DeterministicSeed());
+    const auto ref_func = std::get<0>(this->GetParam());
+    const auto test_func = std::get<1>(this->GetParam());
+    const int shift = std::get<2>(this->GetParam());
+    for (int w = 1; w <= 80; ++w) {
+      const int h = 1 + rnd.PseudoUniform(6);
+      const int src_stride = w + rnd.PseudoUniform(5);
+      const int dst_stride = w + rnd.PseudoUniform(5);
+      std::vector<SrcT> src(src_stride * h);
+      for (auto &s : src) s = static_cast<SrcT>(rnd.Rand16());
+      std::vector<DstT> ref(dst_stride * h, 0x55);
+      std::vector<DstT> test(dst_stride * h, 0x55);
+      ref_func(src.data(), src_stride, ref.data(), dst_stride, w, h, shift);
+      test_func(src.data(), src_stride, test.data(), dst_stride, w, h, shift);
+      ASSERT_EQ(ref, test) << "w " << w << " h " << h << " shift " << shift;
+    }
+  }
+};
+
+using UpshiftPlane8To16Test = ImageShiftTest<uint8_t, uint16_t>;
+using DownshiftPlane16To8Test = ImageShiftTest<uint16_t, uint8_t>;
+using ShiftPlane16Test = ImageShiftTest<uint16_t, uint16_t>;
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(UpshiftPlane8To16Test);
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(DownshiftPlane16To8Test);
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(ShiftPlane16Test);
+
+TEST_P(UpshiftPlane8To16Test, CheckOutput) { RunCheckOutput(); }
+TEST_P(DownshiftPlane16To8Test, CheckOutput) { RunCheckOutput(); }
+TEST_P(ShiftPlane16Test, CheckOutput) { RunCheckOutput(); }
+
+#if HAVE_SSE2
+INSTANTIATE_TEST_SUITE_P(
+    SSE2, UpshiftPlane8To16Test,
+    ::testing::Combine(::testing::Values(&aom_upshift_plane_8_to_16_c),
+                       ::testing::Values(&aom_upshift_plane_8_to_16_sse2),
+                       ::testing::Range(0, 9)));
+
+INSTANTIATE_TEST_SUITE_P(
+    SSE2, DownshiftPlane16To8Test,
+    ::testing::Combine(::testing::Values(&aom_downshift_plane_16_to_8_c),
+                       ::testing::Values(&aom_downshift_plane_16_to_8_sse2),
+                       ::testing::Range(0, 9)));
+
+INSTANTIATE_TEST_SUITE_P(
+    SSE2_Up, ShiftPlane16Test,
+    ::testing::Combine(::testing::Values(&aom_upshift_plane_16_c),
+                       ::testing::Values(&aom_upshift_plane_16_sse2),
+                       ::testing::Range(0, 9)));
+
+INSTANTIATE_TEST_SUITE_P(
+    SSE2_Down, ShiftPlane16Test,
+    ::testing::Combine(::testing::Values(&aom_downshift_plane_16_c),
+                       ::testing::Values(&aom_downshift_plane_16_sse2),
+                       ::testing::Range(0, 9)));
+#endif  // HAVE_SSE2
+
+#if HAVE_AVX2
+INSTANTIATE_TEST_SUITE_P(
+    AVX2, UpshiftPlane8To16Test,
+    ::testing::Combine(::testing::Values(&aom_upshift_plane_8_to_16_c),
+                       ::testing::Values(&aom_upshift_plane_8_to_16_avx2),
+                       ::testing::Range(0, 9)));
+
+INSTANTIATE_TEST_SUITE_P(
+    AVX2, DownshiftPlane16To8Test,
+    ::testing::Combine(::testing::Values(&aom_downshift_plane_16_to_8_c),
+                       ::testing::Values(&aom_downshift_plane_16_to_8_avx2),
+                       ::testing::Range(0, 9)));
+
+INSTANTIATE_TEST_SUITE_P(
+    AVX2_Up, ShiftPlane16Test,
+    ::testing::Combine(::testing::Values(&aom_upshift_plane_16_c),
+                       ::testing::Values(&aom_upshift_plane_16_avx2),
+                       ::testing::Range(0, 9)));
+
+INSTANTIATE_TEST_SUITE_P(
+    AVX2_Down, ShiftPlane16Test,
+    ::testing::Combine(::testing::Values(&aom_downshift_plane_16_c),
+                       ::testing::Values(&aom_downshift_plane_16_avx2),
+                       ::testing::Range(0, 9)));
+#endif  // HAVE_AVX2
+
+}  // namespace
@@ -44,9 +44,27 @@ using libaom_test::ACMRandom;
       const int16_t *iscan
 
 typedef void (*LPQuantizeFunc)(LP_QUANTIZE_PARAM_LIST);
+typedef int64_t (*LPQuantizeDistFunc)(LP_QUANTIZE_PARAM_LIST,
+                                      int *qcoeff_abs_sum);
+typedef int64_t (*BlockErrorLpFunc)(const int16_t *coeff,
+                                    const int16_t *dqcoeff,
+                                    intptr_t block_size);
+typedef int (*SatdLpFunc)(const int16_t *coeff, int length);
 typedef void (*QuantizeFunc)(QUAN_PARAM_LIST);
 typedef void (*QuantizeFuncHbd)(QUAN_PARAM_LIST, int log_scale);
 
+// Runs the fused quantizer as a plain low precision quantizer, and checks its
+// distortion and rate outputs against the separate passes it replaces.
+template <LPQuantizeDistFunc fn, BlockErrorLpFunc error_fn, SatdLpFunc satd_fn>
+void quantize_lp_dist_wrapper(LP_QUANTIZE_PARAM_LIST) {
+  int qcoeff_abs_sum;
+  const int64_t error =
+      fn(coeff_ptr, n_coeffs, round_ptr, quant_ptr, qcoeff_ptr, dqcoeff_ptr,
+         dequant_ptr, eob_ptr, scan, iscan, &qcoeff_abs_sum);
+  EXPECT_EQ(error_fn(coeff_ptr, dqcoeff_ptr, n_coeffs), error);
+  EXPECT_EQ(satd_fn(qcoeff_ptr, static_cast<int>(n_coeffs)), qcoeff_abs_sum);
+}
+
 #undef LP_QUANTIZE_PARAM_LIST
 
 #define HBD_QUAN_FUNC                                                      \
@@ -477,6 +495,24 @@ TEST_P(LowPrecisionQuantizeTest, DISABLED_Speed) {
 
 using std::make_tuple;
 
+const QuantizeParam<LPQuantizeFunc> kLPQDistParamArrayC[] = {
+  make_tuple(&av1_quantize_lp_c,
+             &quantize_lp_dist_wrapper<av1_quantize_lp_dist_c,
+                                       av1_block_error_lp_c, aom_satd_lp_c>,
+             static_cast<TX_SIZE>(TX_16X16), TYPE_FP, AOM_BITS_8),
+  make_tuple(&av1_quantize_lp_c,
+             &quantize_lp_dist_wrapper<av1_quantize_lp_dist_c,
+                                       av1_block_error_lp_c, aom_satd_lp_c>,
+             static_cast<TX_SIZE>(TX_8X8), TYPE_FP, AOM_BITS_8),
+  make_tuple(&av1_quantize_lp_c,
+             &quantize_lp_dist_wrapper<av1_quantize_lp_dist_c,
+                                       av1_block_error_lp_c, aom_satd_lp_c>,
+             static_cast<TX_SIZE>(TX_4X4), TYPE_FP, AOM_BITS_8)
+};
+
+INSTANTIATE_TEST_SUITE_P(C_Dist, LowPrecisionQuantizeTest,
+                         ::testing::ValuesIn(kLPQDistParamArrayC));
+
 #if HAVE_AVX2
 
 const QuantizeParam<LPQuantizeFunc> kLPQParamArrayAvx2[] = {
@@ -491,6 +527,27 @@ const QuantizeParam<LPQuantizeFunc> kLPQParamArrayAvx2[] = {
 INSTANTIATE_TEST_SUITE_P(AVX2, LowPrecisionQuantizeTest,
                          ::testing::ValuesIn(kLPQParamArrayAvx2));
 
+const QuantizeParam<LPQuantizeFunc> kLPQDistParamArrayAvx2[] = {
+  make_tuple(&av1_quantize_lp_c,
+             &quantize_lp_dist_wrapper<av1_quantize_lp_dist_avx2,
+                                       av1_block_error_lp_avx2,
+                                       aom_satd_lp_avx2>,
+             static_cast<TX_SIZE>(TX_16X16), TYPE_FP, AOM_BITS_8),
+  make_tuple(&av1_quantize_lp_c,
+             &quantize_lp_dist_wrapper<av1_quantize_lp_dist_avx2,
+                                       av1_block_error_lp_avx2,
+                                       aom_satd_lp_avx2>,
+             static_cast<TX_SIZE>(TX_8X8), TYPE_FP, AOM_BITS_8),
+  make_tuple(&av1_quantize_lp_c,
+             &quantize_lp_dist_wrapper<av1_quantize_lp_dist_avx2,
+                                       av1_block_error_lp_avx2,
+                                       aom_satd_lp_avx2>,
+             static_cast<TX_SIZE>(TX_4X4), TYPE_FP, AOM_BITS_8)
+};
+
+INSTANTIATE_TEST_SUITE_P(AVX2_Dist, LowPrecisionQuantizeTest,
+                         ::testing::ValuesIn(kLPQDistParamArrayAvx2));
+
 const QuantizeParam<QuantizeFunc> kQParamArrayAvx2[] = {
   make_tuple(&av1_quantize_fp_c, &av1_quantize_fp_avx2,
              static_cast<TX_SIZE>(TX_16X16), TYPE_FP, AOM_BITS_8),
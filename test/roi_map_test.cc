@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2024, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "aom/aom_encoder.h"
+#include "aom/aomcx.h"
+#include "test/codec_factory.h"
+#include "test/encode_test_driver.h"
+#include "test/i420_video_source.h"
+#include "test/util.h"
+
+namespace {
+
+const int kWidth = 352;
+const int kHeight = 288;
+
+// Fills an ROI map with a full effort center region (segment 1) on a low
+// effort background (segment 0).
+void FillRoiMap(aom_roi_map_t *roi, std::vector<unsigned char> *map) {
+  roi->cols = (kWidth + 7) / 8;
+  roi->rows = (kHeight + 7) / 8;
+  map->assign(roi->rows * roi->cols, 0);
+  for (unsigned int r = roi->rows / 4; r < roi->rows * 3 / 4; ++r) {
+    for (unsigned int c = roi->cols / 4; c < roi->cols * 3 / 4; ++c) {
+      (*map)[r * roi->cols + c] = 1;
+    }
+  }
+  roi->roi_map = map->data();
+  roi->delta_q[0] = 40;
+  roi->low_effort[0] = 1;
+  roi->delta_q[1] = -20;
+}
+
+// Params: test mode and speed.
+class RoiMapTest
+    : public ::libaom_test::CodecTestWith2Params<libaom_test::TestMode, int>,
+      public ::libaom_test::EncoderTest {
+ protected:
+  RoiMapTest() : EncoderTest(GET_PARAM(0)) {}
+  ~RoiMapTest() override = default;
+
+  void SetUp() override {
+    InitializeConfig(GET_PARAM(1));
+    cpu_used_ = GET_PARAM(2);
+    cfg_.g_lag_in_frames = 0;
+    cfg_.rc_end_usage = AOM_CBR;
+    cfg_.rc_target_bitrate = 500;
+  }
+
+  void PreEncodeFrameHook(::libaom_test::VideoSource *video,
+                          ::libaom_test::Encoder *encoder) override {
+    if (video->frame() == 0) {
+      encoder->Control(AOME_SET_CPUUSED, cpu_used_);
+      encoder->Control(AV1E_SET_AQ_MODE, 0);
+      aom_roi_map_t roi = aom_roi_map_t();
+      FillRoiMap(&roi, &roi_map_);
+      encoder->Control(AOME_SET_ROI_MAP, &roi);
+    } else if (video->frame() == 6) {
+      // A NULL map disables the ROI map.
+      aom_roi_map_t roi = aom_roi_map_t();
+      roi.cols = (kWidth + 7) / 8;
+      roi.rows = (kHeight + 7) / 8;
+      encoder->Control(AOME_SET_ROI_MAP, &roi);
+    }
+  }
+
+  int cpu_used_;
+  std::vector<unsigned char> roi_map_;
+};
+
+TEST_P(RoiMapTest, Test) {
+  ::libaom_test::I420VideoSource video("hantro_collage_w352h288.yuv", kWidth,
+                                       kHeight, 30, 1, 0, 10);
+  ASSERT_NO_FATAL_FAILURE(RunLoop(&video));
+}
+
+AV1_INSTANTIATE_TEST_SUITE(RoiMapTest,
+                           ::testing::Values(::libaom_test::kRealTime,
+                                             ::libaom_test::kOnePassGood),
+                           ::testing::Values(5, 9));
+
+TEST(RoiMapApiTest, InvalidMap) {
+  aom_codec_iface_t *iface = aom_codec_av1_cx();
+  aom_codec_enc_cfg_t cfg;
+  ASSERT_EQ(aom_codec_enc_config_default(iface, &cfg, AOM_USAGE_REALTIME),
+            AOM_CODEC_OK);
+  cfg.g_w = kWidth;
+  cfg.g_h = kHeight;
+  aom_codec_ctx_t enc;
+  ASSERT_EQ(aom_codec_enc_init(&enc, iface, &cfg, 0), AOM_CODEC_OK);
+
+  aom_roi_map_t roi = aom_roi_map_t();
+  std::vector<unsigned char> map;
+  FillRoiMap(&roi, &map);
+  EXPECT_EQ(aom_codec_control(&enc, AOME_SET_ROI_MAP, &roi), AOM_CODEC_OK);
+
+  // Wrong dimensions.
+  roi.rows--;
+  EXPECT_EQ(aom_codec_control(&enc, AOME_SET_ROI_MAP, &roi),
+            AOM_CODEC_INVALID_PARAM);
+  roi.rows++;
+  // Out of range segment id.
+  map[0] = 8;
+  EXPECT_EQ(aom_codec_control(&enc, AOME_SET_ROI_MAP, &roi),
+            AOM_CODEC_INVALID_PARAM);
+  map[0] = 0;
+  // Out of range quantizer delta.
+  roi.delta_q[2] = 256;
+  EXPECT_EQ(aom_codec_control(&enc, AOME_SET_ROI_MAP, &roi),
+            AOM_CODEC_INVALID_PARAM);
+
+  EXPECT_EQ(aom_codec_destroy(&enc), AOM_CODEC_OK);
+}
+
+}  // namespace
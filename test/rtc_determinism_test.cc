@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2024, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+// The real-time encoder path avoids floating point in its per-block decisions
+// so that a given input produces the same bitstream on every platform. These
+// tests encode a synthetic clip and compare the hash of the output with values
+// that must match on all architectures and compilers. A change that alters
+// real-time encoding output on purpose must update the expected hashes.
+
+#include <cstring>
+
+#include "gtest/gtest.h"
+
+#include "aom/aomcx.h"
+#include "aom/aom_encoder.h"
+#include "aom/aom_image.h"
+#include "test/acm_random.h"
+#include "test/xxhash_helper.h"
+
+namespace {
+
+constexpr int kWidth = 176;
+constexpr int kHeight = 144;
+constexpr int kNumFrames = 10;
+
+struct RtcDeterminismParam {
+  int speed;
+  int aq_mode;
+  const char *expected_hash;
+};
+
+// Fills img with a gradient background, a moving block and a fixed pattern of
+// noise, so the encoder sees motion, flat and textured areas.
+void FillFrame(aom_image_t *img, int frame) {
+  libaom_test::ACMRandom rnd(libaom_test::ACMRandom::DeterministicSeed());
+  for (int y = 0; y < kHeight; ++y) {
+    uint8_t *row = img->planes[AOM_PLANE_Y] + y * img->stride[AOM_PLANE_Y];
+    for (int x = 0; x < kWidth; ++x) {
+      row[x] = static_cast<uint8_t>(((x + y + frame) & 0x7f) +
+                                    (rnd.Rand8() & 0x1f));
+    }
+  }
+  const int block_x = (frame * 5) % (kWidth - 32);
+  const int block_y = (frame * 3) % (kHeight - 32);
+  for (int y = block_y; y < block_y + 32; ++y) {
+    uint8_t *row = img->planes[AOM_PLANE_Y] + y * img->stride[AOM_PLANE_Y];
+    for (int x = block_x; x < block_x + 32; ++x) {
+      row[x] = static_cast<uint8_t>(200 + ((x ^ y) & 0x30));
+    }
+  }
+  for (int plane = AOM_PLANE_U; plane <= AOM_PLANE_V; ++plane) {
+    for (int y = 0; y < kHeight / 2; ++y) {
+      uint8_t *row = img->planes[plane] + y * img->stride[plane];
+      for (int x = 0; x < kWidth / 2; ++x) {
+        row[x] = static_cast<uint8_t>(96 + plane * 16 + ((x + frame) & 0x1f));
+      }
+    }
+  }
+}
+
+class RtcDeterminismTest
+    : public ::testing::TestWithParam<RtcDeterminismParam> {};
+
+TEST_P(RtcDeterminismTest, MatchesExpectedHash) {
+  const RtcDeterminismParam &param = GetParam();
+  aom_codec_iface_t *iface = aom_codec_av1_cx();
+  aom_codec_enc_cfg_t cfg;
+  ASSERT_EQ(aom_codec_enc_config_default(iface, &cfg, AOM_USAGE_REALTIME),
+            AOM_CODEC_OK);
+  cfg.g_w = kWidth;
+  cfg.g_h = kHeight;
+  cfg.g_threads = 1;
+  cfg.g_lag_in_frames = 0;
+  cfg.g_error_resilient = 0;
+  cfg.rc_end_usage = AOM_CBR;
+  cfg.rc_target_bitrate = 200;
+  cfg.rc_min_quantizer = 2;
+  cfg.rc_max_quantizer = 52;
+  cfg.rc_buf_initial_sz = 500;
+  cfg.rc_buf_optimal_sz = 600;
+  cfg.rc_buf_sz = 1000;
+  cfg.rc_undershoot_pct = 50;
+  cfg.rc_overshoot_pct = 50;
+  cfg.kf_max_dist = 9999;
+
+  aom_codec_ctx_t enc;
+  ASSERT_EQ(aom_codec_enc_init(&enc, iface, &cfg, 0), AOM_CODEC_OK);
+  ASSERT_EQ(aom_codec_control(&enc, AOME_SET_CPUUSED, param.speed),
+            AOM_CODEC_OK);
+  ASSERT_EQ(aom_codec_control(&enc, AV1E_SET_AQ_MODE, param.aq_mode),
+            AOM_CODEC_OK);
+
+  aom_image_t img;
+  ASSERT_NE(aom_img_alloc(&img, AOM_IMG_FMT_I420, kWidth, kHeight, 1),
+            nullptr);
+  libaom_test::XXH64 hash;
+  for (int frame = 0; frame <= kNumFrames; ++frame) {
+    // The last iteration flushes the encoder.
+    aom_image_t *const raw = frame < kNumFrames ? &img : nullptr;
+    if (raw != nullptr) FillFrame(raw, frame);
+    ASSERT_EQ(aom_codec_encode(&enc, raw, frame, 1, 0), AOM_CODEC_OK);
+    aom_codec_iter_t iter = nullptr;
+    const aom_codec_cx_pkt_t *pkt;
+    while ((pkt = aom_codec_get_cx_data(&enc, &iter)) != nullptr) {
+      if (pkt->kind != AOM_CODEC_CX_FRAME_PKT) continue;
+      hash.Add(static_cast<const uint8_t *>(pkt->data.frame.buf),
+               pkt->data.frame.sz);
+    }
+  }
+  aom_img_free(&img);
+  EXPECT_EQ(aom_codec_destroy(&enc), AOM_CODEC_OK);
+  EXPECT_STREQ(hash.Get(), param.expected_hash)
+      << "speed " << param.speed << " aq_mode " << param.aq_mode;
+}
+
+const RtcDeterminismParam kRtcDeterminismParams[] = {
+  { 7, 0, "2d4c9587d66e7a37" },
+  { 7, 3, "7eab30d9a7198846" },
+  { 10, 0, "106e87427283b835" },
+  { 10, 3, "ccb1915e8a479965" },
+};
+
+INSTANTIATE_TEST_SUITE_P(AV1, RtcDeterminismTest,
+                         ::testing::ValuesIn(kRtcDeterminismParams));
+
+}  // namespace
@@ -360,4 +360,151 @@ TEST_P(TileGroupTestLarge, TileGroupCountTest) {
 AV1_INSTANTIATE_TEST_SUITE(TileGroupTestLarge,
                            ::testing::ValuesIn(kTestModeParams),
                            ::testing::ValuesIn(tileGroupTestParams));
+
+// This class is used to validate tile configuration for auto balanced tile
+// sizes, whose boundaries may move from frame to frame.
+class AutoBalancedTileConfigTest
+    : public ::libaom_test::CodecTestWith2Params<libaom_test::TestMode, int>,
+      public ::libaom_test::EncoderTest {
+ protected:
+  AutoBalancedTileConfigTest()
+      : EncoderTest(GET_PARAM(0)), encoding_mode_(GET_PARAM(1)),
+        sb_size_(GET_PARAM(2)) {}
+  ~AutoBalancedTileConfigTest() override = default;
+
+  void SetUp() override {
+    InitializeConfig(encoding_mode_);
+    const aom_rational timebase = { 1, 30 };
+    cfg_.g_timebase = timebase;
+    cfg_.rc_end_usage = AOM_Q;
+    cfg_.g_threads = 2;
+    cfg_.g_lag_in_frames = 0;
+    // Negative sizes request auto balanced tiles.
+    cfg_.tile_width_count = 1;
+    cfg_.tile_widths[0] = -1;
+    cfg_.tile_height_count = 1;
+    cfg_.tile_heights[0] = -1;
+  }
+
+  bool DoDecode() const override { return true; }
+
+  void PreEncodeFrameHook(::libaom_test::VideoSource *video,
+                          ::libaom_test::Encoder *encoder) override {
+    if (video->frame() == 0) {
+      encoder->Control(AOME_SET_CPUUSED, 5);
+      encoder->Control(AV1E_SET_ROW_MT, 0);
+      encoder->Control(AV1E_SET_TILE_COLUMNS, 1);
+      encoder->Control(AV1E_SET_TILE_ROWS, 1);
+      encoder->Control(AV1E_SET_SUPERBLOCK_SIZE,
+                       sb_size_ == 64 ? AOM_SUPERBLOCK_SIZE_64X64
+                                      : AOM_SUPERBLOCK_SIZE_128X128);
+    }
+  }
+
+  bool HandleDecodeResult(const aom_codec_err_t res_dec,
+                          libaom_test::Decoder *decoder) override {
+    EXPECT_EQ(AOM_CODEC_OK, res_dec) << decoder->DecodeError();
+    if (AOM_CODEC_OK == res_dec) {
+      aom_codec_ctx_t *ctx_dec = decoder->GetDecoder();
+      aom_tile_info tile_info;
+      AOM_CODEC_CONTROL_TYPECHECKED(ctx_dec, AOMD_GET_TILE_INFO, &tile_info);
+
+      // The number of tiles is kept, and the tiles cover the frame.
+      EXPECT_EQ(tile_info.tile_columns, 2);
+      EXPECT_EQ(tile_info.tile_rows, 2);
+      int width_sb = 0;
+      for (int i = 0; i < tile_info.tile_columns; ++i) {
+        EXPECT_GT(tile_info.tile_widths[i], 0);
+        width_sb += tile_info.tile_widths[i];
+      }
+      int height_sb = 0;
+      for (int i = 0; i < tile_info.tile_rows; ++i) {
+        EXPECT_GT(tile_info.tile_heights[i], 0);
+        height_sb += tile_info.tile_heights[i];
+      }
+      EXPECT_EQ(width_sb, (352 + sb_size_ - 1) / sb_size_);
+      EXPECT_EQ(height_sb, (288 + sb_size_ - 1) / sb_size_);
+    }
+    return AOM_CODEC_OK == res_dec;
+  }
+
+  ::libaom_test::TestMode encoding_mode_;
+  const int sb_size_;
+};
+
+TEST_P(AutoBalancedTileConfigTest, AutoBalancedTileConfigTest) {
+  libaom_test::I420VideoSource video("hantro_collage_w352h288.yuv", 352, 288,
+                                     cfg_.g_timebase.den, cfg_.g_timebase.num,
+                                     0, 8);
+  ASSERT_NO_FATAL_FAILURE(RunLoop(&video));
+}
+
+AV1_INSTANTIATE_TEST_SUITE(AutoBalancedTileConfigTest,
+                           ::testing::ValuesIn(kTestModeParams),
+                           ::testing::Values(64, 128));
+
+// Tuning for a number of decoder threads selects one tile per thread and
+// reports a predicted decode time.
+class DecodeSpeedTileConfigTest
+    : public ::libaom_test::CodecTestWith2Params<libaom_test::TestMode, int>,
+      public ::libaom_test::EncoderTest {
+ protected:
+  DecodeSpeedTileConfigTest()
+      : EncoderTest(GET_PARAM(0)), encoding_mode_(GET_PARAM(1)),
+        decoder_threads_(GET_PARAM(2)) {}
+  ~DecodeSpeedTileConfigTest() override = default;
+
+  void SetUp() override {
+    InitializeConfig(encoding_mode_);
+    const aom_rational timebase = { 1, 30 };
+    cfg_.g_timebase = timebase;
+    cfg_.rc_end_usage = AOM_Q;
+    cfg_.g_threads = 1;
+    cfg_.g_lag_in_frames = 0;
+  }
+
+  bool DoDecode() const override { return true; }
+
+  void PreEncodeFrameHook(::libaom_test::VideoSource *video,
+                          ::libaom_test::Encoder *encoder) override {
+    if (video->frame() == 0) {
+      encoder->Control(AOME_SET_CPUUSED, 5);
+      encoder->Control(AV1E_SET_TARGET_DECODER_THREADS, decoder_threads_);
+    }
+  }
+
+  void PostEncodeFrameHook(::libaom_test::Encoder *encoder) override {
+    if (cfg_.g_pass == AOM_RC_FIRST_PASS) return;
+    int decode_time_us = 0;
+    encoder->Control(AV1E_GET_PREDICTED_DECODE_TIME, &decode_time_us);
+    EXPECT_GT(decode_time_us, 0);
+  }
+
+  bool HandleDecodeResult(const aom_codec_err_t res_dec,
+                          libaom_test::Decoder *decoder) override {
+    EXPECT_EQ(AOM_CODEC_OK, res_dec) << decoder->DecodeError();
+    if (AOM_CODEC_OK == res_dec) {
+      aom_codec_ctx_t *ctx_dec = decoder->GetDecoder();
+      aom_tile_info tile_info;
+      AOM_CODEC_CONTROL_TYPECHECKED(ctx_dec, AOMD_GET_TILE_INFO, &tile_info);
+      EXPECT_EQ(tile_info.tile_columns * tile_info.tile_rows,
+                decoder_threads_);
+    }
+    return AOM_CODEC_OK == res_dec;
+  }
+
+  ::libaom_test::TestMode encoding_mode_;
+  const int decoder_threads_;
+};
+
+TEST_P(DecodeSpeedTileConfigTest, DecodeSpeedTileConfigTest) {
+  libaom_test::I420VideoSource video("hantro_collage_w352h288.yuv", 352, 288,
+                                     cfg_.g_timebase.den, cfg_.g_timebase.num,
+                                     0, 3);
+  ASSERT_NO_FATAL_FAILURE(RunLoop(&video));
+}
+
+AV1_INSTANTIATE_TEST_SUITE(DecodeSpeedTileConfigTest,
+                           ::testing::ValuesIn(kTestModeParams),
+                           ::testing::Values(1, 4));
 }  // namespace
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2024, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#ifndef AOM_TEST_XXHASH_HELPER_H_
+#define AOM_TEST_XXHASH_HELPER_H_
+
+#include <cinttypes>
+#include <cstdio>
+
+#include "aom/aom_decoder.h"
+#include "common/xxhash_utils.h"
+
+namespace libaom_test {
+// Drop-in replacement for libaom_test::MD5 for tests that only compare the
+// hashes of two outputs with each other. Tests that check against stored MD5
+// sums keep using MD5.
+class XXH64 {
+ public:
+  XXH64() { XXH64Init(&xxh64_); }
+
+  void Add(const aom_image_t *img) {
+    for (int plane = 0; plane < 3; ++plane) {
+      const uint8_t *buf = img->planes[plane];
+      const int bytes_per_sample =
+          (img->fmt & AOM_IMG_FMT_HIGHBITDEPTH) ? 2 : 1;
+      const int h =
+          plane ? (img->d_h + img->y_chroma_shift) >> img->y_chroma_shift
+                : img->d_h;
+      const int w =
+          (plane ? (img->d_w + img->x_chroma_shift) >> img->x_chroma_shift
+                 : img->d_w) *
+          bytes_per_sample;
+
+      for (int y = 0; y < h; ++y) {
+        XXH64Update(&xxh64_, buf, w);
+        buf += img->stride[plane];
+      }
+    }
+  }
+
+  void Add(const uint8_t *data, size_t size) {
+    XXH64Update(&xxh64_, data, size);
+  }
+
+  const char *Get() {
+    snprintf(res_, sizeof(res_), "%016" PRIx64, XXH64Final(&xxh64_));
+    return res_;
+  }
+
+ protected:
+  char res_[17];
+  XXH64Context xxh64_;
+};
+
+}  // namespace libaom_test
+
+#endif  // AOM_TEST_XXHASH_HELPER_H_
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2024, Alliance for Open Media. All rights reserved.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "common/xxhash_utils.h"
+#include "gtest/gtest.h"
+#include "test/acm_random.h"
+
+namespace {
+
+uint64_t HashString(const char *str) {
+  XXH64Context ctx;
+  XXH64Init(&ctx);
+  XXH64Update(&ctx, reinterpret_cast<const unsigned char *>(str), strlen(str));
+  return XXH64Final(&ctx);
+}
+
+// Reference values from the xxHash implementation.
+TEST(XXH64Test, KnownValues) {
+  EXPECT_EQ(HashString(""), 0xef46db3751d8e999ULL);
+  EXPECT_EQ(HashString("a"), 0xd24ec4f1a98c6e5bULL);
+  EXPECT_EQ(HashString("abc"), 0x44bc2cf5ad770999ULL);
+  EXPECT_EQ(HashString("Nobody inspects the spammish repetition"),
+            0xfbcea83c8a378bf1ULL);
+}
+
+// Hashing in pieces, such as the rows of a frame, must match hashing the
+// whole buffer at once.
+TEST(XXH64Test, Streaming) {
+  libaom_test::ACMRandom rnd(libaom_test::ACMRandom::DeterministicSeed());
+  std::vector<unsigned char> data(1000);
+  for (auto &d : data) d = rnd.Rand8();
+
+  XXH64Context ctx;
+  XXH64Init(&ctx);
+  XXH64Update(&ctx, data.data(), data.size());
+  const uint64_t expected = XXH64Final(&ctx);
+
+  for (size_t chunk = 1; chunk <= 65; ++chunk) {
+    XXH64Init(&ctx);
+    for (size_t i = 0; i < data.size(); i += chunk) {
+      XXH64Update(&ctx, data.data() + i, std::min(chunk, data.size() - i));
+    }
+    EXPECT_EQ(XXH64Final(&ctx), expected) << "chunk " << chunk;
+  }
+}
+
+}  // namespace